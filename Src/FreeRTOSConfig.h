@@ -74,6 +74,32 @@ to exclude the API function. */
 #define INCLUDE_vTaskDelay    1
 
 #define configUSE_EDF_SCHEDULER 1
+#define configUSE_EDF_HEAP_READY_QUEUE 0
+#define configEDF_MAX_READY_TASKS 8
+#define configUSE_EDF_BUCKET_READY_QUEUE 0
+#define configEDF_BUCKET_COUNT 256
+#define configUSE_EDF_ADMISSION_CONTROL 1
+#define configEDF_MAX_ADMITTED_TASKS 8
+#define configUSE_EDF_DEADLINE_MISS_DETECTION 1
+#define configUSE_EDF_BUDGET_ENFORCEMENT 1
+#define configEDF_BUDGET_OVERRUN_ACTION tskEDF_BUDGET_THROTTLE
+#define configUSE_EDF_CBS 1
+#define configUSE_EDF_SRP 0
+#define configUSE_EDF_DEADLINE_INHERITANCE 0
+#define configUSE_EDF_SHARED_STACK 0
+#define configUSE_EDF_FINE_TIME 0
+#define configUSE_EDF_EVENT_TICK 0
+#define configUSE_TIMING_WHEEL 1
+#define configTIMING_WHEEL_SLOTS 32
+#define configEDF_TIE_BREAK tskEDF_TIE_KEEP_RUNNING
+#define configUSE_EDF_ISR_RELEASE_QUEUE 0
+#define configUSE_EDF_JOB_RECORDS 0
+#define configEDF_JOB_RECORD_COUNT 32
+
+/* Charge the EDF budgets from Timer 1, which main.c runs at PCLK / ( T1PR + 1 ),
+about 60 counts per 1 ms tick. */
+#define portEDF_GET_BUDGET_COUNTER() T1TC
+#define configEDF_BUDGET_COUNTS_PER_TICK 60
 
 /* configure run-time stats */
 #define configUSE_STATS_FORMATTING_FUNCTIONS    1
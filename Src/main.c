@@ -75,10 +75,38 @@
 #define PERIOD_BTN1         		50
 #define PERIOD_BTN2         		50
 #define PERIOD_TRANSMITTER     		100
-#define PERIOD_UART            		20
 #define PERIOD_LOAD1           		10
 #define PERIOD_LOAD2           		100
 
+/* DEADLINES: relative to each release, no longer than the period */
+#define DEADLINE_BTN1         		10
+#define DEADLINE_BTN2         		10
+#define DEADLINE_TRANSMITTER   		PERIOD_TRANSMITTER
+#define DEADLINE_LOAD1         		PERIOD_LOAD1
+#define DEADLINE_LOAD2         		PERIOD_LOAD2
+
+/* WCET: worst case execution time estimates, in ticks.  The budgets are
+ * charged from Timer 1, which also counts the tick interrupt and the context
+ * switches, so the loads are given more than their 5 ms and 12 ms busy loops. */
+#define WCET_BTN1           		1
+#define WCET_BTN2           		1
+#define WCET_TRANSMITTER       		1
+#define WCET_LOAD1             		6
+#define WCET_LOAD2             		14
+
+/* PHASES: first release of each task, in ticks after the scheduler starts.
+ * Spread so that no two tasks are released on the same tick. */
+#define PHASE_LOAD1            		0
+#define PHASE_BTN1             		2
+#define PHASE_BTN2             		3
+#define PHASE_TRANSMITTER      		4
+#define PHASE_LOAD2            		5
+
+/* UART SERVER: the receiver only runs when data arrives, as a constant
+ * bandwidth server of 1 tick every 5 ticks */
+#define SERVER_BUDGET_UART     		1
+#define SERVER_PERIOD_UART     		5
+
 /* STRINGS */
 #define STR_POSITIVE_BTN1  		"\n\nButton 1 :: Positive Edge\n"
 #define STR_NEGATIVE_BTN1  		"\n\nButton 1 :: Negative Edge\n"
@@ -124,13 +152,24 @@ void vApplicationTickHook (void)					/* TICK Visualization */
 
 }
 
+void vApplicationDeadlineMissHook (TaskHandle_t xTask, TickType_t xLateness)	/* Deadline Miss Visualization */
+{
+	
+	( void ) xTask;
+	( void ) xLateness;
+	
+	GPIO_write(PORT_1,PIN2,PIN_IS_HIGH);
+	GPIO_write(PORT_1,PIN2,PIN_IS_LOW);
+
+}
+
 void Button_1_Monitor( void * pvParameters )				/* BTN 1: Monitor the if any change happens on Port 0, Pin 0 */
 {
 
 	uint8_t i = 0;
     pinState_t Button1_NewState;
 	pinState_t  Button1_OldState = GPIO_read(PORT_0 , PIN0);
-	TickType_t xLastWakeTime = xTaskGetTickCount();
+	TickType_t xLastWakeTime = xTaskGetReleaseTime( NULL );
 
 	for( ;; )
 	{
@@ -168,7 +207,7 @@ void Button_2_Monitor( void * pvParameters )				/* BTN 2: Monitor if any change
 
 	uint8_t i = 0;
 	pinState_t  Button2_OldState = GPIO_read(PORT_0 , PIN1);
-	TickType_t xLastWakeTime = xTaskGetTickCount();
+	TickType_t xLastWakeTime = xTaskGetReleaseTime( NULL );
 	pinState_t Button2_NewState;
 
 	for( ;; )
@@ -205,7 +244,7 @@ void Periodic_Transmitter (void * pvParameters )			/* Transmitter: Periodiclly s
 {
 
 	uint8_t i = 0;
-	TickType_t xLastWakeTime = xTaskGetTickCount();
+	TickType_t xLastWakeTime = xTaskGetReleaseTime( NULL );
 
 	for( ; ; )
 	{
@@ -222,26 +261,19 @@ void Periodic_Transmitter (void * pvParameters )			/* Transmitter: Periodiclly s
 
 void Uart_Receiver (void * pvParameters )				/* UART: Recieve the data sent to the UART */
 {
-	TickType_t xLastWakeTime = xTaskGetTickCount();
 	char Rx_String[28];
 	uint8_t i = 0;
 	
 	for( ; ; )
 	{
 		
-		if( uxQueueMessagesWaiting(xQueue__Buffer) != 0)
+		/* Block until the characters of a string arrive */
+		for( i = 0 ; i < 28 ; i++)
 		{
-			
-			for( i = 0 ; i < 28 ; i++)
-			{
-				xQueueReceive( xQueue__Buffer, (Rx_String+i) , 0);
-			}
-			vSerialPutString( (signed char *) Rx_String, 28);
-			xQueueReset(xQueue__Buffer);
-			
+			xQueueReceive( xQueue__Buffer, (Rx_String+i) , portMAX_DELAY);
 		}
+		vSerialPutString( (signed char *) Rx_String, 28);
 		
-		vTaskDelayUntil( &xLastWakeTime , PERIOD_UART);
 	}
 }
 	
@@ -252,7 +284,7 @@ void Uart_Receiver (void * pvParameters )				/* UART: Recieve the data sent to t
 void Load_1_Simulation ( void * pvParameters )				/* Load 1: Perform CPU Load for 5ms*/
 {
 	
-	TickType_t xLastWakeTime = xTaskGetTickCount();
+	TickType_t xLastWakeTime = xTaskGetReleaseTime( NULL );
 	uint32_t i = 0;
 	uint32_t Period = DELAY_5ms;
 	
@@ -272,7 +304,7 @@ void Load_1_Simulation ( void * pvParameters )				/* Load 1: Perform CPU Load fo
 void Load_2_Simulation ( void * pvParameters )				/* Load 2: Perform CPU Load for 12ms*/
 {
 	
-	TickType_t xLastWakeTime = xTaskGetTickCount();
+	TickType_t xLastWakeTime = xTaskGetReleaseTime( NULL );
 	uint32_t i = 0;
 	uint32_t Period = DELAY_12ms; 
 		
@@ -317,59 +349,75 @@ int main( void )
 	xQueue__Buffer = xQueueCreate( 28, sizeof(char) );
 
     /* Tasks Creation */
-	xTaskPeriodicCreate(
+	xTaskPeriodicCreateConstrained(
 			Button_1_Monitor,						/* Task */
 			"BTN 1",							/* Name */
 			100,								/* Size */
 			( void * ) 0,							/* Parameter in*/
 			1,								/* Priority */
 			&BTN1_Handle,							/* Handle*/
-			PERIOD_BTN1);							/* Periodicity*/
+			PERIOD_BTN1,							/* Periodicity */
+			DEADLINE_BTN1,							/* Relative deadline */
+			WCET_BTN1,								/* WCET */
+			PHASE_BTN1);								/* Phase */
 
-	xTaskPeriodicCreate(
+	xTaskPeriodicCreateConstrained(
 			Button_2_Monitor,						/* Task */
 			"BTN 2",							/* Name */
 			100, 								/* Size */
 			( void * ) 0,							/* Parameter in*/
 			1,								/* Priority */
 			&BTN2_Handle,							/* Handle */
-			PERIOD_BTN2);							/* Periodicity */
+			PERIOD_BTN2,							/* Periodicity */
+			DEADLINE_BTN2,							/* Relative deadline */
+			WCET_BTN2,								/* WCET */
+			PHASE_BTN2);								/* Phase */
 
-	xTaskPeriodicCreate(
+	xTaskPeriodicCreateConstrained(
 			Periodic_Transmitter,						/* Task */
 			"PERIODIC TRANSMITTER",						/* Name */
 			100,								/* Size */
 			( void * ) 0,							/* Parameter in*/
 			1,								/* Priority */
 			&Periodic_Handle,						/* Handle */
-			PERIOD_TRANSMITTER);						/* Periodicity */
+			PERIOD_TRANSMITTER,						/* Periodicity */
+			DEADLINE_TRANSMITTER,						/* Relative deadline */
+			WCET_TRANSMITTER,							/* WCET */
+			PHASE_TRANSMITTER);							/* Phase */
 
-	xTaskPeriodicCreate(
+	xTaskCBSCreate(
 			Uart_Receiver,							/* Task */
 			"UART",								/* Name */
 			100,								/* Size */
 			( void * ) 0,							/* Parameter in */
 			1,								/* Priority */
 			&UART_Handle,							/* Handle */
-			PERIOD_UART);							/* Periodicity */
+			SERVER_BUDGET_UART,						/* Server budget */
+			SERVER_PERIOD_UART);						/* Server period */
 
-	xTaskPeriodicCreate(
+	xTaskPeriodicCreateConstrained(
 			Load_1_Simulation,						/* Task */
 			"LOAD1",							/* Name */
 			100,								/* Size */
 			( void * ) 0,							/* Parameter in */
 			1,								/* Priority */
 			&Load1_Handle,							/* Handle */
-			PERIOD_LOAD1);							/* Periodicity */
+			PERIOD_LOAD1,						/* Periodicity */
+			DEADLINE_LOAD1,						/* Relative deadline */
+			WCET_LOAD1,							/* WCET */
+			PHASE_LOAD1);							/* Phase */
 
-	xTaskPeriodicCreate(
+	xTaskPeriodicCreateConstrained(
 			Load_2_Simulation,						/* Task */
 			"LOAD2",							/* Name */
 			100,								/* Size */
 			( void * ) 0,							/* Parameter in */
 			1,								/* Priority */
 			&Load2_Handle,							/* Handle */
-			PERIOD_LOAD2);							/* Periodicity */
+			PERIOD_LOAD2,						/* Periodicity */
+			DEADLINE_LOAD2,						/* Relative deadline */
+			WCET_LOAD2,							/* WCET */
+			PHASE_LOAD2);							/* Phase */
 
 	
 		
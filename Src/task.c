@@ -115,6 +115,365 @@
     #define configIDLE_TASK_NAME    "IDLE"
 #endif
 
+/* Set configUSE_EDF_HEAP_READY_QUEUE to 1 in FreeRTOSConfig.h to hold the EDF
+ * ready tasks in a binary min-heap keyed by deadline instead of the sorted
+ * xReadyTasksListEDF.  Insertion and removal are then O(log n) rather than
+ * O(n).  configEDF_MAX_READY_TASKS sets the capacity of the heap. */
+#ifndef configUSE_EDF_HEAP_READY_QUEUE
+    #define configUSE_EDF_HEAP_READY_QUEUE    0
+#endif
+
+#ifndef configEDF_MAX_READY_TASKS
+    #define configEDF_MAX_READY_TASKS    8
+#endif
+
+/* Set configUSE_EDF_BUCKET_READY_QUEUE to 1 in FreeRTOSConfig.h to hold the
+ * EDF ready tasks in configEDF_BUCKET_COUNT buckets indexed by deadline modulo
+ * configEDF_BUCKET_COUNT, with a bitmap of the non-empty buckets.  Insertion,
+ * removal and selection are then O(1) for every deadline that falls less than
+ * configEDF_BUCKET_COUNT ticks after the current tick count.  Deadlines beyond
+ * that window are kept in a sorted overflow list until the window reaches
+ * them. */
+#ifndef configUSE_EDF_BUCKET_READY_QUEUE
+    #define configUSE_EDF_BUCKET_READY_QUEUE    0
+#endif
+
+#ifndef configEDF_BUCKET_COUNT
+    #define configEDF_BUCKET_COUNT    256
+#endif
+
+#if ( ( configUSE_EDF_HEAP_READY_QUEUE == 1 ) && ( configUSE_EDF_BUCKET_READY_QUEUE == 1 ) )
+    #error configUSE_EDF_HEAP_READY_QUEUE and configUSE_EDF_BUCKET_READY_QUEUE cannot both be set to 1.
+#endif
+
+/* Set configUSE_EDF_ADMISSION_CONTROL to 1 in FreeRTOSConfig.h to have
+ * xTaskPeriodicCreateConstrained() refuse a task, with errTASK_NOT_SCHEDULABLE,
+ * if EDF could no longer meet every deadline of the admitted tasks once it is
+ * added.  That is the case if the total utilization would go above 1 or, when
+ * some deadlines are shorter than their periods, if the processor demand
+ * analysis finds an interval that asks for more time than it is long.  Only
+ * the tasks that declare a WCET are recorded, and configEDF_MAX_ADMITTED_TASKS
+ * sets how many of them there can be. */
+#ifndef configUSE_EDF_ADMISSION_CONTROL
+    #define configUSE_EDF_ADMISSION_CONTROL    0
+#endif
+
+#ifndef configEDF_MAX_ADMITTED_TASKS
+    #define configEDF_MAX_ADMITTED_TASKS    8
+#endif
+
+/* Set configUSE_EDF_DEADLINE_MISS_DETECTION to 1 in FreeRTOSConfig.h to count,
+ * per task, the jobs that miss their deadline and by how much, and to have
+ * vApplicationDeadlineMissHook() called once for each of them.  The tick
+ * interrupt only looks at the running task and at the Ready task with the
+ * earliest deadline, which are normally the same task, so a miss that
+ * neither of them shows is noticed when the late job completes. */
+#ifndef configUSE_EDF_DEADLINE_MISS_DETECTION
+    #define configUSE_EDF_DEADLINE_MISS_DETECTION    0
+#endif
+
+/* The values configEDF_BUDGET_OVERRUN_ACTION can take. */
+#define tskEDF_BUDGET_THROTTLE    0
+#define tskEDF_BUDGET_DEMOTE      1
+#define tskEDF_BUDGET_NOTIFY      2
+
+/* Set configUSE_EDF_BUDGET_ENFORCEMENT to 1 in FreeRTOSConfig.h to give each
+ * job of a task that declares a WCET a budget of that much execution time, so
+ * a job that overruns cannot push the other tasks past their deadlines.  What
+ * happens to a job that runs for longer than its budget is set by
+ * configEDF_BUDGET_OVERRUN_ACTION:
+ *
+ * tskEDF_BUDGET_THROTTLE - the task is Blocked until its next release, when it
+ *                          gets a new budget and a deadline one period later.
+ *                          A task holding a mutex is not Blocked, but is
+ *                          treated as tskEDF_BUDGET_DEMOTE.
+ * tskEDF_BUDGET_DEMOTE   - the task stays Ready with a new budget but with its
+ *                          deadline one period later, so it only runs once the
+ *                          jobs due before then are done.
+ * tskEDF_BUDGET_NOTIFY   - the task keeps running and
+ *                          vApplicationBudgetOverrunHook() is called.
+ *
+ * A task that overruns while it holds an SRP resource keeps running, with its
+ * deadline, until it unlocks the last resource it holds, and only then is the
+ * action taken.
+ *
+ * The task that a tick interrupt finds running is charged the whole tick,
+ * unless portEDF_GET_BUDGET_COUNTER() is defined to read a free running
+ * counter that advances configEDF_BUDGET_COUNTS_PER_TICK times per tick.  The
+ * running task is then charged the counts that have passed at each tick and
+ * each context switch, so a task is only charged for the time it has run. */
+#ifndef configUSE_EDF_BUDGET_ENFORCEMENT
+    #define configUSE_EDF_BUDGET_ENFORCEMENT    0
+#endif
+
+#ifndef configEDF_BUDGET_OVERRUN_ACTION
+    #define configEDF_BUDGET_OVERRUN_ACTION    tskEDF_BUDGET_THROTTLE
+#endif
+
+#if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+    #if ( ( configEDF_BUDGET_OVERRUN_ACTION != tskEDF_BUDGET_THROTTLE ) && ( configEDF_BUDGET_OVERRUN_ACTION != tskEDF_BUDGET_DEMOTE ) && ( configEDF_BUDGET_OVERRUN_ACTION != tskEDF_BUDGET_NOTIFY ) )
+        #error configEDF_BUDGET_OVERRUN_ACTION must be tskEDF_BUDGET_THROTTLE, tskEDF_BUDGET_DEMOTE or tskEDF_BUDGET_NOTIFY.
+    #endif
+
+    #if defined( portEDF_GET_BUDGET_COUNTER ) && !defined( configEDF_BUDGET_COUNTS_PER_TICK )
+        #error configEDF_BUDGET_COUNTS_PER_TICK must be defined when portEDF_GET_BUDGET_COUNTER() is defined.
+    #endif
+#endif
+
+/* Set configUSE_EDF_CBS to 1 in FreeRTOSConfig.h to be able to run a task as
+ * a constant bandwidth server with xTaskCBSCreate() or xTaskCBSAttach().  The
+ * server has a budget Q and a period P, and its task is scheduled by EDF on
+ * the server deadline.  When the task leaves the Blocked state the server
+ * starts a new deadline P ticks on, with a full budget, unless what is left of
+ * its budget can still be used before the current deadline without going over
+ * the bandwidth Q / P.  When the task has used up its budget the budget is
+ * filled again and the deadline moved P ticks on.  The task can therefore
+ * block on queues, notifications or interrupts and still be guaranteed Q / P
+ * of the processor, while being unable to take more than that from the other
+ * tasks when they need it.  The budgets are charged as described for
+ * configUSE_EDF_BUDGET_ENFORCEMENT, which must also be set to 1. */
+#ifndef configUSE_EDF_CBS
+    #define configUSE_EDF_CBS    0
+#endif
+
+#if ( ( configUSE_EDF_CBS == 1 ) && ( configUSE_EDF_BUDGET_ENFORCEMENT != 1 ) )
+    #error configUSE_EDF_BUDGET_ENFORCEMENT must be set to 1 in FreeRTOSConfig.h to use configUSE_EDF_CBS.
+#endif
+
+/* Set configUSE_EDF_SRP to 1 in FreeRTOSConfig.h to share resources between
+ * EDF tasks under the Stack Resource Policy.  The preemption level of a task
+ * is its relative deadline, a shorter deadline being a higher level.  Each
+ * resource created by xTaskSRPResourceCreate() has a ceiling, the shortest
+ * relative deadline of the tasks vTaskSRPResourceUsedBy() declared as its
+ * users, and the system ceiling is the lowest ceiling of the resources that
+ * are locked.  A task that becomes Ready while its relative deadline is not
+ * shorter than the system ceiling is held back until the ceiling drops, so a
+ * job that has started never has to wait for a resource: vTaskSRPLock() does
+ * not block.  A job is blocked for at most one critical section of a task
+ * with a later deadline, and the resources cannot deadlock.  Resources must
+ * be unlocked in the reverse order they were locked in, and a task must not
+ * block while it holds one.  A task that uses up its budget while it holds one
+ * keeps its deadline, so stays above the ceiling it raised, until it unlocks
+ * the last. */
+#ifndef configUSE_EDF_SRP
+    #define configUSE_EDF_SRP    0
+#endif
+
+/* Set configUSE_EDF_DEADLINE_INHERITANCE to 1 in FreeRTOSConfig.h to have a
+ * task that holds a mutex inherit the deadline of a task that blocks on the
+ * mutex, if that deadline is earlier, in the way it would otherwise inherit
+ * the priority.  The holder is then scheduled on the inherited deadline until
+ * it has given back all the mutexes it holds, so tasks with deadlines between
+ * the two cannot delay it.  The deadline of the job itself, which deadline
+ * misses, budgets and servers use, is not changed.  A holder keeps the
+ * deadline it inherited when the task it inherited from times out. */
+#ifndef configUSE_EDF_DEADLINE_INHERITANCE
+    #define configUSE_EDF_DEADLINE_INHERITANCE    0
+#endif
+
+#if ( ( configUSE_EDF_DEADLINE_INHERITANCE == 1 ) && ( configUSE_MUTEXES != 1 ) )
+    #error configUSE_MUTEXES must be set to 1 in FreeRTOSConfig.h to use configUSE_EDF_DEADLINE_INHERITANCE.
+#endif
+
+/* Set configUSE_EDF_SHARED_STACK to 1 in FreeRTOSConfig.h to be able to create
+ * EDF tasks with xTaskPeriodicCreateShared() that run their jobs on a single
+ * stack of configEDF_SHARED_STACK_DEPTH words instead of a stack each.  Such a
+ * task is given a job function that runs one job to completion and returns,
+ * and the kernel calls it once per release.  A job is given the stack space
+ * below the jobs it preempts when it first runs, and gives it back when it
+ * completes.  Under EDF a preempted job cannot run again until the jobs that
+ * preempted it have completed, so the shared stack only has to be as deep as
+ * the deepest chain of preemptions rather than the sum of the task stacks.
+ * That only holds if a job never blocks, so a job function must not block and
+ * must use SRP resources (see configUSE_EDF_SRP) rather than mutexes, and the
+ * task must not be suspended while its job runs.  For the same reason such a
+ * task cannot be a constant bandwidth server, and a task with a WCET is
+ * refused, with pdFAIL, unless configEDF_BUDGET_OVERRUN_ACTION is
+ * tskEDF_BUDGET_NOTIFY, as the other actions give way mid-job.  A task deleted
+ * while its job runs gives its part of the stack back once the jobs above it
+ * have completed. */
+#ifndef configUSE_EDF_SHARED_STACK
+    #define configUSE_EDF_SHARED_STACK    0
+#endif
+
+#ifndef configEDF_SHARED_STACK_DEPTH
+    #define configEDF_SHARED_STACK_DEPTH    ( ( uint32_t ) configMINIMAL_STACK_SIZE * 4U )
+#endif
+
+#if ( configUSE_EDF_SHARED_STACK == 1 )
+    #if ( portSTACK_GROWTH > 0 ) || ( portUSING_MPU_WRAPPERS == 1 )
+        #error configUSE_EDF_SHARED_STACK needs a port without MPU support whose stack grows down.
+    #endif
+#endif
+
+/* Set configUSE_EDF_FINE_TIME to 1 in FreeRTOSConfig.h to count EDF time in
+ * units of the free running counter read by portEDF_GET_BUDGET_COUNTER(),
+ * configEDF_BUDGET_COUNTS_PER_TICK of them to a tick, rather than in ticks.
+ * The periods, relative deadlines, WCETs, phases and server budgets given to
+ * the kernel, the wake times the tasks pass to xTaskDelayUntil(), and the
+ * release times, deadlines and lateness the kernel keeps and reports are then
+ * all in counts.  A task can have a period that is not a whole number of
+ * ticks, such as 2.5 ms, and jobs due within the same tick run in the order
+ * they are due.  Jobs are still released by the tick interrupt, on the first
+ * tick at or after their release time.  EDF time is the tick count multiplied
+ * by configEDF_BUDGET_COUNTS_PER_TICK plus the counts since the last tick, so
+ * the counter does not have to be in step with the tick. */
+#ifndef configUSE_EDF_FINE_TIME
+    #define configUSE_EDF_FINE_TIME    0
+#endif
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FINE_TIME == 1 ) )
+    #if !defined( portEDF_GET_BUDGET_COUNTER ) || !defined( configEDF_BUDGET_COUNTS_PER_TICK )
+        #error portEDF_GET_BUDGET_COUNTER() and configEDF_BUDGET_COUNTS_PER_TICK must be defined to use configUSE_EDF_FINE_TIME.
+    #endif
+
+    #if ( configUSE_16_BIT_TICKS == 1 )
+        #error configUSE_EDF_FINE_TIME needs 32-bit ticks.
+    #endif
+
+    #if ( configUSE_EDF_BUCKET_READY_QUEUE == 1 )
+        #error configUSE_EDF_BUCKET_READY_QUEUE cannot be used with configUSE_EDF_FINE_TIME, as its window would only span configEDF_BUCKET_COUNT counts.
+    #endif
+#endif
+
+/* Set configUSE_EDF_EVENT_TICK to 1 in FreeRTOSConfig.h to drive the EDF
+ * scheduler from a one-shot compare on the counter read by
+ * portEDF_GET_BUDGET_COUNTER() rather than from a periodic tick.  The kernel
+ * sets the compare for the first tick on which something can happen: a task
+ * is due to be released or to wake, the running job would miss its deadline,
+ * or it would use up its budget.  The port must define
+ * portEDF_SET_COMPARE( ulCounterValue ) to make the compare interrupt fire once
+ * the counter reaches ulCounterValue, at once if it already has.  It must not
+ * start a periodic tick, and must call xTaskEDFEventTick() from the compare
+ * interrupt in place of xTaskIncrementTick().  The tick count is kept as
+ * before, configEDF_BUDGET_COUNTS_PER_TICK counts to a tick, but the ticks
+ * between two events are counted when the second event comes, so
+ * vApplicationTickHook() is not called for all of them. */
+#ifndef configUSE_EDF_EVENT_TICK
+    #define configUSE_EDF_EVENT_TICK    0
+#endif
+
+#if ( configUSE_EDF_EVENT_TICK == 1 )
+    #if ( configUSE_EDF_SCHEDULER == 0 )
+        #error configUSE_EDF_EVENT_TICK needs configUSE_EDF_SCHEDULER.
+    #endif
+
+    #if !defined( portEDF_GET_BUDGET_COUNTER ) || !defined( configEDF_BUDGET_COUNTS_PER_TICK ) || !defined( portEDF_SET_COMPARE )
+        #error portEDF_GET_BUDGET_COUNTER(), portEDF_SET_COMPARE() and configEDF_BUDGET_COUNTS_PER_TICK must be defined to use configUSE_EDF_EVENT_TICK.
+    #endif
+
+    #if ( configUSE_TICKLESS_IDLE != 0 )
+        #error configUSE_TICKLESS_IDLE cannot be used with configUSE_EDF_EVENT_TICK, which does not tick while idle anyway.
+    #endif
+#endif
+
+/* Set configUSE_TIMING_WHEEL to 1 in FreeRTOSConfig.h to hold the tasks that
+ * are delayed, or blocked with a timeout, for less than
+ * configTIMING_WHEEL_SLOTS * configTIMING_WHEEL_SLOTS ticks in a two level
+ * timing wheel rather than in the sorted delayed task lists, so a task is
+ * added in constant time.  The first level has a slot for each of the next
+ * configTIMING_WHEEL_SLOTS ticks.  The second has a slot for each of the next
+ * configTIMING_WHEEL_SLOTS runs of configTIMING_WHEEL_SLOTS ticks, and its
+ * tasks are moved down to the first level, one slot at a time, when the tick
+ * count reaches the start of their run.  Longer delays still go into the
+ * delayed task lists. */
+#ifndef configUSE_TIMING_WHEEL
+    #define configUSE_TIMING_WHEEL    0
+#endif
+
+#ifndef configTIMING_WHEEL_SLOTS
+    #define configTIMING_WHEEL_SLOTS    32
+#endif
+
+#if ( configUSE_TIMING_WHEEL == 1 )
+    #if ( ( configTIMING_WHEEL_SLOTS < 32 ) || ( configTIMING_WHEEL_SLOTS > 1024 ) || ( ( configTIMING_WHEEL_SLOTS & ( configTIMING_WHEEL_SLOTS - 1 ) ) != 0 ) )
+        #error configTIMING_WHEEL_SLOTS must be a power of 2 between 32 and 1024.
+    #endif
+#endif
+
+/* Set configUSE_EDF_ISR_RELEASE_QUEUE to 1 in FreeRTOSConfig.h to keep the
+ * sorted insertion into the ready queue out of the interrupts that wake tasks.
+ * xTaskResumeFromISR(), the FromISR notification functions and
+ * xTaskRemoveFromEventList(), which the FromISR queue and semaphore functions
+ * call, then append the woken task to a list of pending releases in constant
+ * time.  Whether it preempts is still decided there, on its deadline.  The
+ * tick interrupt and the next context switch move the pending releases to the
+ * ready queue together, as the tasks a tick releases are moved. */
+#ifndef configUSE_EDF_ISR_RELEASE_QUEUE
+    #define configUSE_EDF_ISR_RELEASE_QUEUE    0
+#endif
+
+#if ( ( configUSE_EDF_ISR_RELEASE_QUEUE == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
+    #error configUSE_EDF_ISR_RELEASE_QUEUE needs configUSE_EDF_SCHEDULER.
+#endif
+
+/* Set configUSE_EDF_JOB_RECORDS to 1 in FreeRTOSConfig.h to have the kernel
+ * record the timing of each job a periodic task completes: its release, the
+ * first time it ran, the time it completed, the number of times it was
+ * preempted and its lateness.  The records are kept in a ring of
+ * configEDF_JOB_RECORD_COUNT entries, which a low priority task empties with
+ * xTaskGetNextJobRecord().  The start and completion times are read from
+ * portEDF_GET_BUDGET_COUNTER() where the port defines it, and are tick counts
+ * otherwise.  A record that finds the ring full is dropped and counted, see
+ * uxTaskGetLostJobRecordCount(). */
+#ifndef configUSE_EDF_JOB_RECORDS
+    #define configUSE_EDF_JOB_RECORDS    0
+#endif
+
+#ifndef configEDF_JOB_RECORD_COUNT
+    #define configEDF_JOB_RECORD_COUNT    32
+#endif
+
+#if ( configUSE_EDF_JOB_RECORDS == 1 )
+    #if ( configUSE_EDF_SCHEDULER == 0 )
+        #error configUSE_EDF_JOB_RECORDS needs configUSE_EDF_SCHEDULER.
+    #endif
+
+    #if ( ( configEDF_JOB_RECORD_COUNT < 2 ) || ( ( configEDF_JOB_RECORD_COUNT & ( configEDF_JOB_RECORD_COUNT - 1 ) ) != 0 ) )
+        #error configEDF_JOB_RECORD_COUNT must be a power of 2.
+    #endif
+#endif
+
+/* The values configEDF_TIE_BREAK can take. */
+#define tskEDF_TIE_KEEP_RUNNING    0
+#define tskEDF_TIE_FIFO            1
+#define tskEDF_TIE_ROUND_ROBIN     2
+
+/* configEDF_TIE_BREAK sets how the EDF scheduler treats a task that has the
+ * same deadline as the running task:
+ *
+ * tskEDF_TIE_KEEP_RUNNING - the running task carries on, as switching would
+ *                           not make either task meet its deadline sooner.
+ * tskEDF_TIE_FIFO         - the job released first runs first, so a task that
+ *                           leaves the Blocked state with a job released
+ *                           before that of the running task preempts it.
+ * tskEDF_TIE_ROUND_ROBIN  - the tasks share the processor a tick at a time, as
+ *                           tasks of equal priority do without EDF.  A task
+ *                           on the shared stack or holding an SRP resource is
+ *                           not switched out.
+ *
+ * configUSE_TIME_SLICING is not used under EDF.  vTaskGetTieBreakStats()
+ * returns the counts needed to compare the policies. */
+#ifndef configEDF_TIE_BREAK
+    #define configEDF_TIE_BREAK    tskEDF_TIE_KEEP_RUNNING
+#endif
+
+#if ( ( configEDF_TIE_BREAK != tskEDF_TIE_KEEP_RUNNING ) && ( configEDF_TIE_BREAK != tskEDF_TIE_FIFO ) && ( configEDF_TIE_BREAK != tskEDF_TIE_ROUND_ROBIN ) )
+    #error configEDF_TIE_BREAK must be tskEDF_TIE_KEEP_RUNNING, tskEDF_TIE_FIFO or tskEDF_TIE_ROUND_ROBIN.
+#endif
+
+/* Returned when a task is refused by the EDF admission control.  The error
+ * codes are otherwise defined in projdefs.h. */
+#ifndef errTASK_NOT_SCHEDULABLE
+    #define errTASK_NOT_SCHEDULABLE    ( -6 )
+#endif
+
+#if ( configUSE_EDF_BUCKET_READY_QUEUE == 1 )
+    #if ( ( configEDF_BUCKET_COUNT < 32 ) || ( configEDF_BUCKET_COUNT > 1024 ) || ( ( configEDF_BUCKET_COUNT & ( configEDF_BUCKET_COUNT - 1 ) ) != 0 ) )
+        #error configEDF_BUCKET_COUNT must be a power of 2 between 32 and 1024.
+    #endif
+#endif
+
 #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
 
 /* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 0 then task selection is
@@ -226,12 +585,148 @@
     taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                \
     vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
     tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
-#else
-#define prvAddTaskToReadyList( pxTCB )	/* xStateListItem must contain the deadline value */					 \
+#elif ( ( configUSE_EDF_HEAP_READY_QUEUE == 0 ) && ( configUSE_EDF_BUCKET_READY_QUEUE == 0 ) )
+#define prvAddTaskToReadyList( pxTCB )	/* the list is ordered on taskEDF_DEADLINE() */					 \
 traceMOVED_TASK_TO_READY_STATE( pxTCB );																															 \
-vListInsert( &xReadyTasksListEDF, &( ( pxTCB )->xStateListItem ) );																		 \
+taskEDF_CBS_WAKE( pxTCB );                                                                           \
+if( taskEDF_SRP_HOLD_BACK( pxTCB ) == pdFALSE )                                                      \
+{                                                                                                    \
+    listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), taskEDF_DEADLINE( pxTCB ) );             \
+    prvEDFListInsert( &xReadyTasksListEDF, &( ( pxTCB )->xStateListItem ) );                         \
+}                                                                                                    \
 tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+#else
+/* The heap or the buckets order the tasks, so xReadyTasksListEDF only records
+ * which tasks are in the Ready state and the item can be appended in O(1). */
+#define prvAddTaskToReadyList( pxTCB )                                                       \
+    traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                 \
+    taskEDF_CBS_WAKE( pxTCB );                                                               \
+    if( taskEDF_SRP_HOLD_BACK( pxTCB ) == pdFALSE )                                          \
+    {                                                                                        \
+        listINSERT_END( &xReadyTasksListEDF, &( ( pxTCB )->xStateListItem ) );               \
+        taskEDF_INSERT_READY_QUEUE( pxTCB );                                                 \
+    }                                                                                        \
+    tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+#endif
+
+/*
+ * Used in place of prvAddTaskToReadyList() where an interrupt can wake the
+ * task.  With configUSE_EDF_ISR_RELEASE_QUEUE the task only joins the pending
+ * releases, which prvEDFReadyPendingReleases() moves to the ready queue, and
+ * taskEDF_IS_PENDING_RELEASE() is pdTRUE until then.
+ */
+#if ( configUSE_EDF_ISR_RELEASE_QUEUE == 1 )
+    #define prvAddWokenTaskToReadyList( pxTCB )    prvEDFDeferRelease( pxTCB )
+    #define taskEDF_IS_PENDING_RELEASE( pxTCB )    listIS_CONTAINED_WITHIN( &xEDFPendingReleases, &( ( pxTCB )->xStateListItem ) )
+#else
+    #define prvAddWokenTaskToReadyList( pxTCB )    prvAddTaskToReadyList( pxTCB )
+    #define taskEDF_IS_PENDING_RELEASE( pxTCB )    ( pdFALSE )
+#endif
+/*-----------------------------------------------------------*/
+
+/*
+ * The EDF equivalents of taskSELECT_HIGHEST_PRIORITY_TASK() and
+ * taskRESET_READY_PRIORITY().  taskEDF_RESET_READY_QUEUE() must be called
+ * after the xStateListItem of a task that may be in the Ready state has been
+ * removed from its list, so any ordering structure kept next to
+ * xReadyTasksListEDF can forget the task too.  taskEDF_INSERT_READY_QUEUE()
+ * adds a task to that ordering structure.
+ *
+ * The idle task is never in the ready queue.  It has no deadline to order it
+ * against the other tasks, so taskEDF_GET_EARLIEST_DEADLINE_TASK() returns it
+ * whenever the queue is empty, and NULL only before it has been created.
+ */
+#if ( configUSE_EDF_DEADLINE_INHERITANCE == 1 )
+    /* The earlier of the deadline of the job and the deadline the task has
+     * inherited through a mutex. */
+    #define taskEDF_DEADLINE( pxTCB )                                                                  \
+    ( ( ( ( pxTCB )->xDeadlineInherited != pdFALSE ) &&                                                \
+        ( taskEDF_TICK_IS_AFTER( ( pxTCB )->xAbsoluteDeadline, ( pxTCB )->xInheritedDeadline ) ) ) ? \
+      ( pxTCB )->xInheritedDeadline : ( pxTCB )->xAbsoluteDeadline )
+#else
+    #define taskEDF_DEADLINE( pxTCB )    ( ( pxTCB )->xAbsoluteDeadline )
 #endif
+
+/* pdTRUE if tick xA comes after tick xB.  The difference is taken modulo the
+ * tick range, so the result stays right across a tick count overflow as long
+ * as the two are less than half the range apart.  BaseType_t is not used for
+ * this as it need not be the same width as TickType_t.  The ready queue and
+ * the event lists are ordered with it, so the deadlines pending at any one time
+ * must lie within half the range of each other - half the range of counts when
+ * configUSE_EDF_FINE_TIME is set. */
+#define taskEDF_TICK_IS_AFTER( xA, xB )    ( ( ( TickType_t ) ( ( xA ) - ( xB ) ) - ( TickType_t ) 1U ) < ( portMAX_DELAY >> 1 ) )
+
+/* EDF time, in which release times and deadlines are kept.  It is the tick
+ * count unless configUSE_EDF_FINE_TIME is set.  taskEDF_TIME_NOW() must be
+ * given the current tick count.  taskEDF_TICKS_UNTIL() is the number of ticks
+ * from the tick count xTickNow to the first tick at or after the EDF time
+ * xTime, which must not be before the start of that tick. */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FINE_TIME == 1 ) )
+    #define taskEDF_TIME_FROM_TICKS( xTicks )    ( ( TickType_t ) ( xTicks ) * ( TickType_t ) configEDF_BUDGET_COUNTS_PER_TICK )
+    #define taskEDF_TIME_NOW( xTickNow )         prvEDFTimeNow( xTickNow )
+    #define taskEDF_TICKS_UNTIL( xTime, xTickNow ) \
+    ( ( ( TickType_t ) ( ( xTime ) - taskEDF_TIME_FROM_TICKS( xTickNow ) ) + ( TickType_t ) ( configEDF_BUDGET_COUNTS_PER_TICK - 1 ) ) / ( TickType_t ) configEDF_BUDGET_COUNTS_PER_TICK )
+#else
+    #define taskEDF_TIME_FROM_TICKS( xTicks )         ( xTicks )
+    #define taskEDF_TIME_NOW( xTickNow )              ( xTickNow )
+    #define taskEDF_TICKS_UNTIL( xTime, xTickNow )    ( ( TickType_t ) ( ( xTime ) - ( xTickNow ) ) )
+#endif
+
+/* With configUSE_EDF_EVENT_TICK set the tick count is only brought up to date
+ * when an event falls due, so the ticks the counter has passed since then, and
+ * any held pending while the scheduler is suspended, are added to it wherever
+ * the time now is needed. */
+#if ( configUSE_EDF_EVENT_TICK == 1 )
+    #define taskTICKS_NOT_COUNTED() \
+    ( xPendedTicks + ( TickType_t ) ( ( ( uint32_t ) portEDF_GET_BUDGET_COUNTER() - ulEDFCounterAtTick ) / ( uint32_t ) configEDF_BUDGET_COUNTS_PER_TICK ) )
+#else
+    #define taskTICKS_NOT_COUNTED()    ( ( TickType_t ) 0U )
+#endif
+
+#define taskTICK_COUNT_NOW()    ( xTickCount + taskTICKS_NOT_COUNTED() )
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_HEAP_READY_QUEUE == 1 ) )
+
+    #define taskEDF_GET_EARLIEST_DEADLINE_TASK()    ( ( uxEDFHeapSize > 0U ) ? pxEDFReadyHeap[ 0 ] : ( TCB_t * ) xIdleTaskHandle )
+
+    #define taskEDF_RESET_READY_QUEUE( pxTCB )                             \
+    {                                                                      \
+        if( ( pxTCB )->uxEDFHeapIndex != taskEDF_HEAP_INDEX_NONE )         \
+        {                                                                  \
+            prvEDFHeapRemove( pxTCB );                                     \
+        }                                                                  \
+    }
+
+    #define taskEDF_INSERT_READY_QUEUE( pxTCB )    prvEDFHeapInsert( pxTCB )
+
+#elif ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BUCKET_READY_QUEUE == 1 ) )
+
+    #define taskEDF_GET_EARLIEST_DEADLINE_TASK()    prvEDFBucketGetFirst()
+
+    #define taskEDF_RESET_READY_QUEUE( pxTCB )                             \
+    {                                                                      \
+        if( ( pxTCB )->uxEDFBucket != taskEDF_BUCKET_NONE )                \
+        {                                                                  \
+            prvEDFBucketRemove( pxTCB );                                   \
+        }                                                                  \
+    }
+
+    #define taskEDF_INSERT_READY_QUEUE( pxTCB )    prvEDFBucketInsert( pxTCB )
+
+#else /* configUSE_EDF_HEAP_READY_QUEUE */
+
+    #define taskEDF_GET_EARLIEST_DEADLINE_TASK() \
+    ( ( listLIST_IS_EMPTY( &xReadyTasksListEDF ) != pdFALSE ) ? ( TCB_t * ) xIdleTaskHandle : ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( xReadyTasksListEDF ) ) )
+
+    #define taskEDF_RESET_READY_QUEUE( pxTCB )
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_HEAP_READY_QUEUE == 1 ) */
+
+#define taskSELECT_EARLIEST_DEADLINE_TASK()                     \
+    {                                                           \
+        pxCurrentTCB = taskEDF_GET_EARLIEST_DEADLINE_TASK();    \
+        configASSERT( pxCurrentTCB != NULL );                   \
+    }
 /*-----------------------------------------------------------*/
 
 /*
@@ -256,6 +751,28 @@ tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
     #define taskEVENT_LIST_ITEM_VALUE_IN_USE    0x80000000UL
 #endif
 
+/* pdTRUE if the event list item value of a task can be reset to reflect a new
+ * priority.  Under EDF the value is set from the deadline of the task each time
+ * the task is placed in an ordered event list, and a priority must not replace
+ * it. */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+    #define taskEVENT_LIST_ITEM_VALUE_IS_PRIORITY( pxTCB )    ( pdFALSE )
+#else
+    #define taskEVENT_LIST_ITEM_VALUE_IS_PRIORITY( pxTCB ) \
+    ( ( listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+#endif
+
+/* pdTRUE if pxTCB, which has just left the Blocked or Suspended state, should
+ * preempt the running task.  xHigherPriority is the priority comparison the
+ * kernel makes at that point without EDF.  Under EDF the deadlines decide
+ * instead, and xHigherPriority is only used to count the context switches the
+ * deadlines avoid. */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+    #define taskWOKEN_TASK_PREEMPTS( pxTCB, xHigherPriority )    prvEDFWokenTaskPreempts( ( pxTCB ), ( xHigherPriority ) )
+#else
+    #define taskWOKEN_TASK_PREEMPTS( pxTCB, xHigherPriority )    ( xHigherPriority )
+#endif
+
 /*
  * Task control block.  A task control block (TCB) is allocated for each task,
  * and stores task state information, including a pointer to the task's context
@@ -272,7 +789,57 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
 		/* E.C. : the period of a task */
 		#if ( configUSE_EDF_SCHEDULER == 1 )
 		TickType_t xTaskPeriod; /*< Stores the period in tick of the task. > */
+		TickType_t xRelativeDeadline; /*< Time allowed to each job after its release.  No greater than xTaskPeriod. */
+		TickType_t xWCET;             /*< Worst case execution time estimate of a job, in ticks.  0 if unknown. */
+		TickType_t xPhase;            /*< Offset of the first release from the creation of the task. */
+		TickType_t xReleaseTime;      /*< Tick at which the current job of the task was released. */
+		#if ( configUSE_EDF_DEADLINE_MISS_DETECTION == 1 )
+		BaseType_t xDeadlineMissed;   /*< pdTRUE once the current job has been found to be late, so each miss is only reported once. */
+		UBaseType_t uxDeadlineMisses; /*< Number of jobs that missed their deadline. */
+		TickType_t xMaxLateness;      /*< Longest time, in ticks, by which a job completed after its deadline. */
+		uint32_t ulTotalLateness;     /*< Sum of the lateness of the jobs that missed their deadline. */
+		#endif
+		#if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+		uint32_t ulBudgetUsed;        /*< Execution time charged to the current job, in ticks or in portEDF_GET_BUDGET_COUNTER() counts. */
+		BaseType_t xBudgetExhausted;  /*< pdTRUE once the current job has run for longer than its budget. */
+		UBaseType_t uxBudgetOverruns; /*< Number of times a job of the task has run for longer than its budget. */
 		#endif
+		#if ( configUSE_EDF_JOB_RECORDS == 1 )
+		uint32_t ulJobStartTime;      /*< taskEDF_JOB_TIMESTAMP() when the current job first ran. */
+		BaseType_t xJobStarted;       /*< pdTRUE once the current job has run, so ulJobStartTime is only set once per job. */
+		UBaseType_t uxJobPreemptions; /*< Number of times the current job was switched out while still Ready. */
+		#endif
+		#if ( configUSE_EDF_CBS == 1 )
+		BaseType_t xCBSServer;        /*< pdTRUE if the task runs as a constant bandwidth server, with xWCET as its budget and xTaskPeriod as its period. */
+		BaseType_t xCBSActive;        /*< pdTRUE while a server task is Ready or Running, so the server deadline is only revised when the task wakes. */
+		#endif
+		#if ( configUSE_EDF_DEADLINE_INHERITANCE == 1 )
+		TickType_t xInheritedDeadline;  /*< Earliest deadline of the tasks that blocked on a mutex the task holds.  Only valid while xDeadlineInherited is pdTRUE. */
+		BaseType_t xDeadlineInherited;  /*< pdTRUE while the task is scheduled on xInheritedDeadline rather than on the deadline of its job. */
+		#endif
+		#if ( configUSE_EDF_SRP == 1 )
+		UBaseType_t uxSRPResourcesHeld; /*< Number of SRP resources the task holds.  A task holding one is never held back by the system ceiling. */
+		#endif
+		#if ( configUSE_EDF_SHARED_STACK == 1 )
+		TaskFunction_t pxJobCode;       /*< Function run once per job by a task that uses the shared stack. */
+		void * pvJobParameters;         /*< Parameter passed to pxJobCode. */
+		struct tskTaskControlBlock * pxSharedStackPrevious; /*< The task whose job is below this one on the shared stack. */
+		UBaseType_t uxSharedStackJob;   /*< taskEDF_JOB_NOT_STARTED, taskEDF_JOB_STARTED or taskEDF_JOB_COMPLETED. */
+		#endif
+		BaseType_t xEventListItemOnDeadline; /*< pdTRUE if xEventListItem was last placed in an event list ordered on the deadline, so must be moved if the deadline changes while the task waits. */
+		TickType_t xAbsoluteDeadline; /*< Absolute deadline of the current job.  Set once per job, when the job is released, and used as the ready queue key.  xStateListItem holds the wake time while the task is Blocked, so cannot be used for this. */
+		#endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_HEAP_READY_QUEUE == 1 ) )
+        UBaseType_t uxEDFHeapIndex;     /*< Position of the task in pxEDFReadyHeap, or taskEDF_HEAP_INDEX_NONE when the task is not in the heap. */
+        UBaseType_t uxEDFReadySequence; /*< Value of uxEDFReadySequence when the task entered the heap.  Keeps tasks with equal deadlines in FIFO order, as vListInsert() does. */
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BUCKET_READY_QUEUE == 1 ) )
+        struct tskTaskControlBlock * pxEDFBucketNext;     /*< Next task in the same EDF bucket.  The tasks of a bucket form a circular list. */
+        struct tskTaskControlBlock * pxEDFBucketPrevious; /*< Previous task in the same EDF bucket. */
+        UBaseType_t uxEDFBucket;                          /*< Index into pxEDFBuckets of the bucket holding the task, or taskEDF_BUCKET_NONE. */
+    #endif
 
     ListItem_t xStateListItem;                  /*< The list that the state list item of a task is reference from denotes the state of that task (Ready, Blocked, Suspended ). */
     ListItem_t xEventListItem;                  /*< Used to reference a task from an event list. */
@@ -360,8 +927,246 @@ PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
 
 /* E.C. : the new RedyList */
 #if ( configUSE_EDF_SCHEDULER == 1 )
-#define IDLE_PERIOD (TickType_t)100
 PRIVILEGED_DATA static List_t xReadyTasksListEDF; 												/*< Ready tasks ordered by their deadline. */
+PRIVILEGED_DATA static List_t xEDFReleasedTasks;													/*< Tasks woken by the tick being processed, ordered by deadline, until prvEDFReadyReleasedTasks() moves them to the ready queue. */
+
+#if ( configUSE_EDF_ISR_RELEASE_QUEUE == 1 )
+PRIVILEGED_DATA static List_t xEDFPendingReleases;													/*< Tasks woken through prvAddWokenTaskToReadyList(), in the order they were woken, that are not yet in the ready queue. */
+#endif
+PRIVILEGED_DATA static TickType_t xEDFReleaseEpoch = taskEDF_TIME_FROM_TICKS( configINITIAL_TICK_COUNT );	/*< EDF time at which the scheduler started.  The phases of the tasks created before then are offsets from it. */
+PRIVILEGED_DATA static volatile UBaseType_t uxEDFAvoidedPreemptions = ( UBaseType_t ) 0U;	/*< Number of times a woken task did not preempt the running task although its priority would have made it do so. */
+PRIVILEGED_DATA static volatile UBaseType_t uxEDFContextSwitches = ( UBaseType_t ) 0U;		/*< Number of times vTaskSwitchContext() selected a different task. */
+PRIVILEGED_DATA static volatile UBaseType_t uxEDFTiesKept = ( UBaseType_t ) 0U;				/*< Number of times a woken task with the deadline of the running task did not preempt it. */
+PRIVILEGED_DATA static volatile UBaseType_t uxEDFTieSwitches = ( UBaseType_t ) 0U;			/*< Number of context switches configEDF_TIE_BREAK asked for between tasks with the same deadline. */
+
+#if ( configUSE_EDF_FINE_TIME == 1 ) || ( configUSE_EDF_EVENT_TICK == 1 )
+PRIVILEGED_DATA static uint32_t ulEDFCounterAtTick = 0UL; /*< Value of portEDF_GET_BUDGET_COUNTER() when the tick count last changed, or with configUSE_EDF_EVENT_TICK, at the last tick counted. */
+#endif
+
+#if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+    #ifdef portEDF_GET_BUDGET_COUNTER
+PRIVILEGED_DATA static uint32_t ulEDFBudgetChargedTime = 0UL; /*< Value of portEDF_GET_BUDGET_COUNTER() when the running task was last charged. */
+
+        #if ( configUSE_EDF_FINE_TIME == 1 )
+            /* The WCETs are already in counts. */
+            #define taskEDF_BUDGET_FROM_TICKS( xTicks )    ( ( uint32_t ) ( xTicks ) )
+        #else
+            #define taskEDF_BUDGET_FROM_TICKS( xTicks )    ( ( uint32_t ) ( xTicks ) * ( uint32_t ) configEDF_BUDGET_COUNTS_PER_TICK )
+        #endif
+
+/* A job that is still running once it has been charged its whole budget needs
+ * more than its budget. */
+        #define taskEDF_BUDGET_EXHAUSTED( pxTCB )    ( ( pxTCB )->ulBudgetUsed >= taskEDF_BUDGET_FROM_TICKS( ( pxTCB )->xWCET ) )
+
+/* Charge the running task for the counts that have passed since it, or the
+ * task it replaced, was last charged.  Called on each tick and on each
+ * context switch. */
+        #define taskEDF_CHARGE_BUDGET( xFromTick )                                   \
+    {                                                                            \
+        const uint32_t ulCounterNow = ( uint32_t ) portEDF_GET_BUDGET_COUNTER(); \
+        ( void ) ( xFromTick );                                                  \
+        pxCurrentTCB->ulBudgetUsed += ulCounterNow - ulEDFBudgetChargedTime;     \
+        ulEDFBudgetChargedTime = ulCounterNow;                                   \
+    }
+
+/* Give the running task the full budget of a new job. */
+        #define taskEDF_NEW_BUDGET()                                                  \
+    {                                                                             \
+        pxCurrentTCB->ulBudgetUsed = 0UL;                                         \
+        pxCurrentTCB->xBudgetExhausted = pdFALSE;                                 \
+        ulEDFBudgetChargedTime = ( uint32_t ) portEDF_GET_BUDGET_COUNTER();       \
+    }
+    #else /* ifdef portEDF_GET_BUDGET_COUNTER */
+        #define taskEDF_BUDGET_FROM_TICKS( xTicks )    ( ( uint32_t ) ( xTicks ) )
+
+/* Without a counter only the tick interrupt charges, one tick to the task it
+ * interrupted.  A job can be charged for a tick it only ran part of, so it has
+ * only overrun once it has been charged more than its budget. */
+        #define taskEDF_BUDGET_EXHAUSTED( pxTCB )    ( ( pxTCB )->ulBudgetUsed > ( uint32_t ) ( pxTCB )->xWCET )
+
+        #define taskEDF_CHARGE_BUDGET( xFromTick )  \
+    {                                           \
+        if( ( xFromTick ) != pdFALSE )          \
+        {                                       \
+            pxCurrentTCB->ulBudgetUsed++;       \
+        }                                       \
+    }
+
+        #define taskEDF_NEW_BUDGET()                          \
+    {                                                     \
+        pxCurrentTCB->ulBudgetUsed = 0UL;                 \
+        pxCurrentTCB->xBudgetExhausted = pdFALSE;         \
+    }
+    #endif /* ifdef portEDF_GET_BUDGET_COUNTER */
+#endif /* configUSE_EDF_BUDGET_ENFORCEMENT */
+
+#if ( configUSE_EDF_CBS == 1 )
+    #define taskEDF_CBS_WAKE( pxTCB )                                                              \
+    {                                                                                          \
+        if( ( ( pxTCB )->xCBSServer != pdFALSE ) && ( ( pxTCB )->xCBSActive == pdFALSE ) )     \
+        {                                                                                      \
+            prvEDFCBSWake( pxTCB );                                                            \
+        }                                                                                      \
+    }
+#else
+    #define taskEDF_CBS_WAKE( pxTCB )
+#endif
+
+#if ( configUSE_EDF_JOB_RECORDS == 1 )
+
+/* The timing of one completed job, as returned by xTaskGetNextJobRecord(). */
+typedef struct xEDF_JOB_RECORD
+{
+    struct tskTaskControlBlock * pxTask; /*< Task that ran the job. */
+    TickType_t xReleaseTime;             /*< Tick at which the job was released. */
+    uint32_t ulStartTime;                /*< taskEDF_JOB_TIMESTAMP() when the job first ran. */
+    uint32_t ulFinishTime;               /*< taskEDF_JOB_TIMESTAMP() when the job completed. */
+    TickType_t xLateness;                /*< Time by which the job completed after its deadline, 0 if it met it. */
+    UBaseType_t uxPreemptions;           /*< Number of times the job was switched out while still Ready. */
+} EDFJobRecord_t;
+
+/* The ring has a single producer, xTaskDelayUntil(), which only writes with
+ * the scheduler suspended, and a single consumer, xTaskGetNextJobRecord().
+ * Each owns one of the indexes, which run freely and are masked when used, so
+ * neither has to hold off the other.  A record is only made visible, by moving
+ * uxEDFJobRecordHead on, once it has been written. */
+PRIVILEGED_DATA static EDFJobRecord_t xEDFJobRecords[ configEDF_JOB_RECORD_COUNT ];
+PRIVILEGED_DATA static volatile UBaseType_t uxEDFJobRecordHead = ( UBaseType_t ) 0U;   /*< Number of records written.  Only the producer moves it. */
+PRIVILEGED_DATA static volatile UBaseType_t uxEDFJobRecordTail = ( UBaseType_t ) 0U;   /*< Number of records read.  Only the consumer moves it. */
+PRIVILEGED_DATA static volatile UBaseType_t uxEDFJobRecordsLost = ( UBaseType_t ) 0U;  /*< Number of records dropped because the ring was full. */
+
+    #ifdef portEDF_GET_BUDGET_COUNTER
+        #define taskEDF_JOB_TIMESTAMP()    ( ( uint32_t ) portEDF_GET_BUDGET_COUNTER() )
+    #else
+        #define taskEDF_JOB_TIMESTAMP()    ( ( uint32_t ) xTickCount )
+    #endif
+
+/* The running task has been dispatched.  Called from vTaskSwitchContext(), and
+ * from xTaskDelayUntil() when the next job is already due, so the job that
+ * follows at once is started without a context switch. */
+    #define taskEDF_JOB_DISPATCHED()                                \
+    {                                                               \
+        if( pxCurrentTCB->xJobStarted == pdFALSE )                  \
+        {                                                           \
+            pxCurrentTCB->ulJobStartTime = taskEDF_JOB_TIMESTAMP(); \
+            pxCurrentTCB->xJobStarted = pdTRUE;                     \
+        }                                                           \
+    }
+
+#endif /* configUSE_EDF_JOB_RECORDS */
+
+#if ( configUSE_EDF_SRP == 1 )
+
+/* A resource shared under the Stack Resource Policy, referenced by an
+ * SRPResourceHandle_t as a task is by a TaskHandle_t.  The locked resources
+ * form a stack through pxPreviousLocked, which is how the system ceiling is
+ * restored when they are unlocked. */
+typedef struct xEDF_SRP_RESOURCE
+{
+    TickType_t xCeiling;                         /*< Shortest relative deadline of the tasks that use the resource. */
+    TickType_t xPreviousCeiling;                 /*< System ceiling before the resource was locked. */
+    struct tskTaskControlBlock * pxHolder;       /*< Task holding the resource, or NULL. */
+    struct xEDF_SRP_RESOURCE * pxPreviousLocked; /*< Resource locked before this one, or NULL. */
+} EDFSRPResource_t;
+
+PRIVILEGED_DATA static TickType_t xEDFSystemCeiling = portMAX_DELAY;  /*< Lowest ceiling of the locked resources, portMAX_DELAY when none is locked. */
+PRIVILEGED_DATA static EDFSRPResource_t * pxEDFLockedResources = NULL; /*< The resource locked last, top of the stack of locked resources. */
+PRIVILEGED_DATA static List_t xEDFCeilingBlockedList;                  /*< Tasks that are Ready but held back by the system ceiling. */
+
+/* Only tasks whose relative deadline is not shorter than the system ceiling
+ * need to be looked at, which no task is while nothing is locked. */
+    #define taskEDF_SRP_HOLD_BACK( pxTCB )                                                                     \
+    ( ( xEDFSystemCeiling != portMAX_DELAY ) && ( ( pxTCB )->xRelativeDeadline >= xEDFSystemCeiling ) && \
+      ( prvEDFSRPHoldBack( pxTCB ) != pdFALSE ) )
+
+/* A task holding a resource runs until it unlocks it, as a task with the same
+ * deadline may not have been held back when it became Ready. */
+    #define taskEDF_TIE_CAN_ROTATE( pxTCB )    ( ( pxTCB )->uxSRPResourcesHeld == ( UBaseType_t ) 0U )
+#else
+    #define taskEDF_SRP_HOLD_BACK( pxTCB )     ( pdFALSE )
+    #define taskEDF_TIE_CAN_ROTATE( pxTCB )    ( pdTRUE )
+#endif
+
+#if ( configUSE_EDF_SHARED_STACK == 1 )
+    /* Values of uxSharedStackJob.  A job that has completed keeps its part of
+     * the shared stack until its task leaves the Ready state. */
+    #define taskEDF_JOB_NOT_STARTED    ( ( UBaseType_t ) 0U )
+    #define taskEDF_JOB_STARTED        ( ( UBaseType_t ) 1U )
+    #define taskEDF_JOB_COMPLETED      ( ( UBaseType_t ) 2U )
+
+PRIVILEGED_DATA static StackType_t xEDFSharedStack[ configEDF_SHARED_STACK_DEPTH ]; /*< The stack the jobs of the tasks created by xTaskPeriodicCreateShared() run on. */
+PRIVILEGED_DATA static TCB_t * pxEDFSharedStackTop = NULL;                          /*< The task whose job started last on the shared stack and has not given its space back, or NULL. */
+
+    #define taskEDF_STACK_IS_SHARED( pxTCB )    ( ( pxTCB )->pxStack == xEDFSharedStack )
+#endif
+
+#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+    /* Utilizations are held as 16.16 fixed point fractions, rounded up so the
+     * admission test stays on the safe side. */
+    #define taskEDF_UTILIZATION_ONE    ( ( uint32_t ) 0x10000UL )
+    #define taskEDF_UTILIZATION( xWCET, xPeriod ) \
+    ( ( uint32_t ) ( ( ( ( uint64_t ) ( xWCET ) << 16 ) + ( uint64_t ) ( xPeriod ) - 1U ) / ( uint64_t ) ( xPeriod ) ) )
+
+/* The timing parameters of an admitted task.  Nothing else is needed by the
+ * schedulability test, which keeps it independent of the TCB. */
+typedef struct xEDF_TASK_PARAMETERS
+{
+    TickType_t xPeriod;
+    TickType_t xRelativeDeadline;
+    TickType_t xWCET;
+} EDFTaskParameters_t;
+
+PRIVILEGED_DATA static EDFTaskParameters_t xEDFAdmittedTasks[ configEDF_MAX_ADMITTED_TASKS ]; /*< Every admitted task that declared a WCET, in no particular order. */
+PRIVILEGED_DATA static UBaseType_t uxEDFAdmittedTaskCount = ( UBaseType_t ) 0U;
+#endif
+
+#if ( configUSE_EDF_HEAP_READY_QUEUE == 1 )
+    #define taskEDF_HEAP_INDEX_NONE    ( ( UBaseType_t ) ~( ( UBaseType_t ) 0U ) )
+
+PRIVILEGED_DATA static TCB_t * pxEDFReadyHeap[ configEDF_MAX_READY_TASKS ]; /*< Ready tasks as a binary min-heap on their deadline.  xReadyTasksListEDF is then unordered. */
+PRIVILEGED_DATA static UBaseType_t uxEDFHeapSize = ( UBaseType_t ) 0U;
+PRIVILEGED_DATA static UBaseType_t uxEDFReadySequence = ( UBaseType_t ) 0U;
+#endif
+
+#if ( configUSE_EDF_BUCKET_READY_QUEUE == 1 )
+    #define taskEDF_BUCKET_LATE         ( ( UBaseType_t ) configEDF_BUCKET_COUNT )
+    #define taskEDF_BUCKET_OVERFLOW     ( taskEDF_BUCKET_LATE + ( UBaseType_t ) 1U )
+    #define taskEDF_BUCKET_NONE         ( ( UBaseType_t ) ~( ( UBaseType_t ) 0U ) )
+    #define taskEDF_BUCKET_MASK         ( ( TickType_t ) configEDF_BUCKET_COUNT - ( TickType_t ) 1U )
+    #define taskEDF_BUCKET_MAP_WORDS    ( configEDF_BUCKET_COUNT / 32 )
+
+/* pxEDFBuckets[ 0 .. configEDF_BUCKET_COUNT - 1 ] hold the tasks whose deadline
+ * lies in [ xEDFBucketBase, xEDFBucketBase + configEDF_BUCKET_COUNT ), one
+ * deadline per bucket.  pxEDFBuckets[ taskEDF_BUCKET_LATE ] holds, sorted, the
+ * tasks whose deadline is already before xEDFBucketBase, and
+ * pxEDFBuckets[ taskEDF_BUCKET_OVERFLOW ] holds, sorted, the tasks whose
+ * deadline is beyond the window. */
+PRIVILEGED_DATA static TCB_t * pxEDFBuckets[ configEDF_BUCKET_COUNT + 2 ];       /*< First task of each bucket. */
+PRIVILEGED_DATA static uint32_t ulEDFBucketMap[ taskEDF_BUCKET_MAP_WORDS ];     /*< One bit per non-empty bucket of the window. */
+PRIVILEGED_DATA static uint32_t ulEDFBucketMapSummary = 0UL;                    /*< One bit per non-zero word of ulEDFBucketMap. */
+PRIVILEGED_DATA static TickType_t xEDFBucketBase = ( TickType_t ) configINITIAL_TICK_COUNT;
+#endif
+#endif
+
+#if ( ( configUSE_EDF_SCHEDULER == 0 ) || ( configUSE_EDF_SHARED_STACK == 0 ) )
+    #define taskEDF_STACK_IS_SHARED( pxTCB )    ( pdFALSE )
+#endif
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BUCKET_READY_QUEUE == 1 ) ) || ( configUSE_TIMING_WHEEL == 1 )
+
+/* Index of the least significant set bit of a non-zero 32-bit word.  Not all
+ * architectures have a count leading/trailing zeros instruction (ARM7TDMI does
+ * not), so a de Bruijn multiply is used: the isolated bit times the sequence
+ * leaves a unique pattern in the top five bits. */
+    static const uint8_t ucDeBruijnBitPosition[ 32 ] =
+    {
+        0U,  1U,  28U, 2U,  29U, 14U, 24U, 3U,  30U, 22U, 20U, 15U, 25U, 17U, 4U,  8U,
+        31U, 27U, 13U, 23U, 21U, 19U, 16U, 7U,  26U, 12U, 18U, 6U,  11U, 5U,  10U, 9U
+    };
+
+    #define taskFIND_FIRST_SET( ulWord ) \
+    ( ( UBaseType_t ) ucDeBruijnBitPosition[ ( ( uint32_t ) ( ( uint32_t ) ( ( ulWord ) & ( 0UL - ( ulWord ) ) ) * 0x077CB531UL ) ) >> 27 ] )
+
 #endif
 
 
@@ -372,6 +1177,29 @@ PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;              /*< Poi
 PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;      /*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
 PRIVILEGED_DATA static List_t xPendingReadyList;                         /*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
+#if ( configUSE_TIMING_WHEEL == 1 )
+    #define taskTIMING_WHEEL_MASK         ( ( TickType_t ) configTIMING_WHEEL_SLOTS - ( TickType_t ) 1U )
+    #define taskTIMING_WHEEL_MAP_WORDS    ( configTIMING_WHEEL_SLOTS / 32 )
+    #define taskTIMING_WHEEL_SPAN         ( ( TickType_t ) configTIMING_WHEEL_SLOTS * ( TickType_t ) configTIMING_WHEEL_SLOTS )
+
+/* pdTRUE if a task due xTicksAhead ticks after the tick count goes into the
+ * timing wheel rather than into a delayed task list. */
+    #define taskTIMING_WHEEL_HOLDS( xTicksAhead )    ( ( TickType_t ) ( ( xTicksAhead ) - ( TickType_t ) 1U ) < ( taskTIMING_WHEEL_SPAN - ( TickType_t ) 1U ) )
+
+/* pdTRUE if pxList is a slot of the timing wheel, so its tasks are Blocked. */
+    #define taskIS_TIMING_WHEEL_SLOT( pxList ) \
+    ( ( ( pxList ) >= &( xTimingWheel[ 0 ][ 0 ] ) ) && ( ( pxList ) <= &( xTimingWheel[ 1 ][ configTIMING_WHEEL_SLOTS - 1 ] ) ) )
+
+/* xTimingWheel[ 0 ][ x ] holds the tasks due on the next tick whose low bits
+ * are x.  xTimingWheel[ 1 ][ x ] holds the tasks due in the next run of
+ * configTIMING_WHEEL_SLOTS ticks whose number, the tick divided by
+ * configTIMING_WHEEL_SLOTS, has low bits x.  The slots are not sorted. */
+PRIVILEGED_DATA static List_t xTimingWheel[ 2 ][ configTIMING_WHEEL_SLOTS ];
+PRIVILEGED_DATA static uint32_t ulTimingWheelMap[ 2 ][ taskTIMING_WHEEL_MAP_WORDS ]; /*< One bit per slot that may hold tasks.  A bit is only cleared once its slot is found to be empty. */
+#else
+    #define taskIS_TIMING_WHEEL_SLOT( pxList )    ( pdFALSE )
+#endif
+
 #if ( INCLUDE_vTaskDelete == 1 )
 
     PRIVILEGED_DATA static List_t xTasksWaitingTermination; /*< Tasks that have been deleted - but their memory not yet freed. */
@@ -549,54 +1377,379 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
  */
 static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+/*
+ * Move a task whose wake time has come from the Blocked state to the Ready
+ * state.  Called from the tick interrupt.  Returns pdTRUE if the task should
+ * preempt the running task.  Under EDF the task is only added to
+ * xEDFReleasedTasks, and pdFALSE is returned.
+ */
+static BaseType_t prvUnblockTaskAtWakeTime( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
 
 /*
- * Helper function used to pad task names with spaces when printing out
- * human readable tables of task information.
+ * Move the tasks woken by the current tick from xEDFReleasedTasks to the ready
+ * queue.  With the sorted ready list they are merged into it in one pass.  If
+ * xCheckPreemption is pdTRUE, returns pdTRUE if the one with the earliest
+ * deadline should preempt the running task.
  */
-    static char * prvWriteNameToBuffer( char * pcBuffer,
-                                        const char * pcTaskName ) PRIVILEGED_FUNCTION;
+#if ( configUSE_EDF_SCHEDULER == 1 )
+    static BaseType_t prvEDFReadyReleasedTasks( const BaseType_t xCheckPreemption ) PRIVILEGED_FUNCTION;
+#endif
 
+/*
+ * prvEDFDeferRelease() does what prvAddTaskToReadyList() does up to the
+ * insertion into the ready queue, and appends the task to xEDFPendingReleases
+ * instead.  prvEDFReadyPendingReleases() moves the pending releases to the
+ * ready queue.  Both must be called from a critical section.
+ */
+#if ( configUSE_EDF_ISR_RELEASE_QUEUE == 1 )
+    static void prvEDFDeferRelease( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+    static void prvEDFReadyPendingReleases( void ) PRIVILEGED_FUNCTION;
 #endif
 
 /*
- * Called after a Task_t structure has been allocated either statically or
- * dynamically to fill in the structure's members.
+ * The timing wheel.  prvTimingWheelInsert() adds a task state list item whose
+ * value, the wake time, is less than taskTIMING_WHEEL_SPAN ticks after the
+ * tick count.  prvTimingWheelTick() wakes the tasks due on the tick count
+ * xTickNow, first moving down the tasks of the second level slot that starts
+ * there, and returns pdTRUE if a context switch is needed.
+ * prvTimingWheelLimitUnblockTime() brings xNextTaskUnblockTime forward to the
+ * next tick on which the wheel has work to do, if that comes first.
  */
-static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
-                                  const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-                                  const uint32_t ulStackDepth,
-                                  void * const pvParameters,
-                                  UBaseType_t uxPriority,
-                                  TaskHandle_t * const pxCreatedTask,
-                                  TCB_t * pxNewTCB,
-                                  const MemoryRegion_t * const xRegions ) PRIVILEGED_FUNCTION;
+#if ( configUSE_TIMING_WHEEL == 1 )
+
+    static void prvTimingWheelInsert( ListItem_t * const pxItem ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvTimingWheelTick( const TickType_t xTickNow ) PRIVILEGED_FUNCTION;
+
+    static void prvTimingWheelLimitUnblockTime( void ) PRIVILEGED_FUNCTION;
+
+    static UBaseType_t prvTimingWheelFindSlot( const UBaseType_t uxLevel,
+                                               const UBaseType_t uxFrom ) PRIVILEGED_FUNCTION;
+
+#endif
 
 /*
- * Called after a new task has been created and initialised to place the task
- * under the control of the scheduler.
+ * Read EDF time when configUSE_EDF_FINE_TIME is set.  The counts since the
+ * last tick are capped at one less than a tick, so EDF time cannot reach the
+ * next tick before the tick interrupt does.  With configUSE_EDF_EVENT_TICK the
+ * ticks are counted from the counter itself, and xTickNow must be
+ * taskTICK_COUNT_NOW().
  */
-static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FINE_TIME == 1 ) )
+
+    static TickType_t prvEDFTimeNow( const TickType_t xTickNow ) PRIVILEGED_FUNCTION;
+
+#endif
 
 /*
- * freertos_tasks_c_additions_init() should only be called if the user definable
- * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
- * called by the function.
+ * Count the ticks the counter has passed since the last tick counted, and set
+ * the compare for the next event.  Both must be called with interrupts masked.
+ * prvEDFCountTicks() returns pdTRUE if a context switch is needed.
  */
-#ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+#if ( configUSE_EDF_EVENT_TICK == 1 )
 
-    static void freertos_tasks_c_additions_init( void ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvEDFCountTicks( void ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFSetNextEvent( void ) PRIVILEGED_FUNCTION;
 
 #endif
 
-/*-----------------------------------------------------------*/
+/*
+ * Record that the current job of pxTCB has missed its deadline, unless that
+ * has already been done, and call vApplicationDeadlineMissHook().
+ * taskEDF_CHECK_DEADLINE() only calls it once the deadline has passed, so
+ * costs a single compare while jobs are on time.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DEADLINE_MISS_DETECTION == 1 ) )
 
-#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    static void prvEDFDeadlineMissed( TCB_t * const pxTCB,
+                                      const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
 
-    TaskHandle_t xTaskCreateStatic( TaskFunction_t pxTaskCode,
-                                    const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-                                    const uint32_t ulStackDepth,
+    #define taskEDF_CHECK_DEADLINE( pxTCB, xTimeNow )                                          \
+    {                                                                                          \
+        if( taskEDF_TICK_IS_AFTER( ( xTimeNow ), ( pxTCB )->xAbsoluteDeadline ) )               \
+        {                                                                                      \
+            prvEDFDeadlineMissed( ( pxTCB ), ( xTimeNow ) );                                   \
+        }                                                                                      \
+    }
+
+#endif
+
+/*
+ * Append the timing of the job the running task has just completed to the job
+ * record ring, and make the next job of the task a new one.  Called from
+ * xTaskDelayUntil() with the scheduler suspended, before the next release is
+ * set.
+ */
+#if ( configUSE_EDF_JOB_RECORDS == 1 )
+
+    static void prvEDFRecordJob( const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Act on the running task, which has run for longer than the budget of its
+ * current job, as configEDF_BUDGET_OVERRUN_ACTION says.  Called from the tick
+ * interrupt, and from vTaskSRPUnlock() for an overrun put off while the task
+ * held a resource.  Returns pdTRUE if a context switch is then needed.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 ) )
+
+    static BaseType_t prvEDFBudgetExhausted( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Queue the running task again, behind the tasks with the same deadline, after
+ * its deadline has been moved later or to let configEDF_TIE_BREAK switch to
+ * one of those tasks.  Returns pdTRUE if another task now comes first.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 ) || ( configEDF_TIE_BREAK != tskEDF_TIE_KEEP_RUNNING ) ) )
+
+    static BaseType_t prvEDFRequeueCurrentTask( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Apply the constant bandwidth server rule to a server task that is leaving
+ * the Blocked or Suspended state, keeping its deadline and what is left of its
+ * budget if that cannot take it over its bandwidth, or starting a new server
+ * period otherwise.  Called by prvAddTaskToReadyList() through
+ * taskEDF_CBS_WAKE().
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_CBS == 1 ) )
+
+    static void prvEDFCBSWake( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Make pxTCB a server with the given budget and period.  Must be called with
+ * the scheduler suspended.  Returns pdTRUE if the running task no longer has
+ * the earliest deadline.
+ */
+    static BaseType_t prvEDFCBSStart( TCB_t * const pxTCB,
+                                      const TickType_t xBudget,
+                                      const TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Called through taskEDF_SRP_HOLD_BACK() by prvAddTaskToReadyList() for a task
+ * whose relative deadline is not shorter than the system ceiling.  Places the
+ * task in xEDFCeilingBlockedList instead of the ready queue, and returns
+ * pdTRUE, unless the task is running or holds a resource.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) )
+
+    static BaseType_t prvEDFSRPHoldBack( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Move the tasks the system ceiling no longer holds back to the ready queue.
+ * Must be called from a critical section.  Returns pdTRUE if one of them has
+ * an earlier deadline than the running task.
+ */
+    static BaseType_t prvEDFSRPReleaseHeldBack( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Insert pxNewListItem into pxList, which is kept in order of EDF time, after
+ * the items whose value does not come after its own.  Unlike vListInsert() the
+ * values are compared with taskEDF_TICK_IS_AFTER(), so a deadline that has
+ * wrapped past zero still sorts after the ones that have not.
+ */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvEDFListInsert( List_t * const pxList,
+                                  ListItem_t * const pxNewListItem ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called through taskWOKEN_TASK_PREEMPTS().  Returns pdTRUE if pxTCB is in the
+ * ready queue and its deadline is earlier than that of the running task.
+ */
+    static BaseType_t prvEDFWokenTaskPreempts( const TCB_t * const pxTCB,
+                                               const BaseType_t xHigherPriority ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Move the event list item of a task whose deadline has changed while it waits
+ * in an event list ordered on deadlines to its new place in that list.  Must be
+ * called from a critical section.  Only a CBS postponement or an inherited
+ * deadline moves the deadline of a waiting task.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( ( configUSE_EDF_CBS == 1 ) || ( configUSE_EDF_DEADLINE_INHERITANCE == 1 ) ) )
+
+    static void prvEDFResortEventListItem( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Place a new task whose first release is still in the future into the
+ * delayed list, so it leaves the Blocked state when that release comes.  Must
+ * be called from a critical section.
+ */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvAddNewTaskToDelayedList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Set the timing parameters of a new periodic task and the release and
+ * deadline of its first job.
+ */
+    static void prvEDFInitialisePeriodicTask( TCB_t * const pxNewTCB,
+                                              const TickType_t xPeriod,
+                                              const TickType_t xRelativeDeadline,
+                                              const TickType_t xWCET,
+                                              const TickType_t xPhase ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Start the job of the task just selected to run on top of the shared stack if
+ * the task uses the shared stack and its job has not started yet.  Called each
+ * time a task is selected.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SHARED_STACK == 1 ) )
+
+    static void prvEDFSharedStackDispatch( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Take pxTCB, whose job has started, out of the chain of jobs on the shared
+ * stack.  Called when the task is deleted.  Must be called from a critical
+ * section.
+ */
+    static void prvEDFSharedStackUnlink( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * The task function of the tasks that use the shared stack.  Calls the job
+ * function of the task once per release.
+ */
+    static portTASK_FUNCTION_PROTO( prvEDFSharedStackJob, pvParameters );
+
+#endif
+
+/*
+ * EDF admission control.  prvEDFDemandTest() decides whether EDF meets every
+ * deadline of the uxTaskCount tasks in pxTasks, using the Quick Processor-demand
+ * Analysis of Zhang and Burns.  It only uses its parameters, so it can be
+ * built and checked on a host as it is.  On failure the first interval length
+ * t at which the demand h( t ) exceeds t is written to pulFailingInterval, or
+ * 0 if the utilization alone is above 1.
+ *
+ * prvEDFAdmissionTest() runs that test on the admitted tasks plus a candidate,
+ * which it leaves in the slot after the last admitted task so the caller can
+ * admit it by incrementing uxEDFAdmittedTaskCount.  prvEDFAdmissionRemove()
+ * forgets an admitted task.  Both must be called with the scheduler suspended
+ * or from a critical section.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_ADMISSION_CONTROL == 1 ) )
+
+    static BaseType_t prvEDFDemandTest( const EDFTaskParameters_t * const pxTasks,
+                                        const UBaseType_t uxTaskCount,
+                                        uint32_t * const pulFailingInterval ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvEDFAdmissionTest( const TickType_t xPeriod,
+                                           const TickType_t xRelativeDeadline,
+                                           const TickType_t xWCET,
+                                           TickType_t * const pxFailingInterval ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFAdmissionRemove( const TickType_t xPeriod,
+                                       const TickType_t xRelativeDeadline,
+                                       const TickType_t xWCET ) PRIVILEGED_FUNCTION;
+
+/*
+ * Admit a task that is about to be created, or give back the admission of a
+ * task that could not be created after all.  A task that declares no WCET
+ * cannot make the set unschedulable, so is always admitted.
+ */
+    static BaseType_t prvEDFAdmitNewTask( const TickType_t xPeriod,
+                                          const TickType_t xRelativeDeadline,
+                                          const TickType_t xWCET ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFUnadmitNewTask( const TickType_t xPeriod,
+                                      const TickType_t xRelativeDeadline,
+                                      const TickType_t xWCET ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Insert a task into, or remove a task from, the EDF ready heap.  Both restore
+ * the heap order in O(log n).  prvEDFHeapSiftDown() is also used on its own
+ * when the deadline of a task already in the heap has been moved later.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_HEAP_READY_QUEUE == 1 ) )
+
+    static void prvEDFHeapInsert( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+    static void prvEDFHeapRemove( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+    static void prvEDFHeapSiftUp( UBaseType_t uxIndex ) PRIVILEGED_FUNCTION;
+    static void prvEDFHeapSiftDown( UBaseType_t uxIndex ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Insert a task into, or remove a task from, the EDF ready buckets, and return
+ * the ready task with the earliest deadline.  prvEDFBucketAdvance() moves the
+ * bucket window up to the tick count passed in.  It is called from
+ * xTaskIncrementTick() so the window start never lags the tick count by more
+ * than the ticks that were pended while the scheduler was suspended.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BUCKET_READY_QUEUE == 1 ) )
+
+    static void prvEDFBucketInsert( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+    static void prvEDFBucketRemove( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+    static TCB_t * prvEDFBucketGetFirst( void ) PRIVILEGED_FUNCTION;
+    static void prvEDFBucketAdvance( const TickType_t xTickNow ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+/*
+ * Helper function used to pad task names with spaces when printing out
+ * human readable tables of task information.
+ */
+    static char * prvWriteNameToBuffer( char * pcBuffer,
+                                        const char * pcTaskName ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Called after a Task_t structure has been allocated either statically or
+ * dynamically to fill in the structure's members.
+ */
+static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
+                                  const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                  const uint32_t ulStackDepth,
+                                  void * const pvParameters,
+                                  UBaseType_t uxPriority,
+                                  TaskHandle_t * const pxCreatedTask,
+                                  TCB_t * pxNewTCB,
+                                  const MemoryRegion_t * const xRegions ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called after a new task has been created and initialised to place the task
+ * under the control of the scheduler.
+ */
+static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * freertos_tasks_c_additions_init() should only be called if the user definable
+ * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
+ * called by the function.
+ */
+#ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+
+    static void freertos_tasks_c_additions_init( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+    TaskHandle_t xTaskCreateStatic( TaskFunction_t pxTaskCode,
+                                    const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                    const uint32_t ulStackDepth,
                                     void * const pvParameters,
                                     UBaseType_t uxPriority,
                                     StackType_t * const puxStackBuffer,
@@ -837,17 +1990,41 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 		
 		 /*E.C. : */
 		#if (configUSE_EDF_SCHEDULER == 1)
-		BaseType_t xTaskPeriodicCreate( TaskFunction_t pxTaskCode,
-													const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-													const configSTACK_DEPTH_TYPE usStackDepth,
-													void * const pvParameters,
-													UBaseType_t uxPriority,
-													TaskHandle_t * const pxCreatedTask, 
-													TickType_t period )
-		{
+    BaseType_t xTaskPeriodicCreateConstrained( TaskFunction_t pxTaskCode,
+                                               const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                               const configSTACK_DEPTH_TYPE usStackDepth,
+                                               void * const pvParameters,
+                                               UBaseType_t uxPriority,
+                                               TaskHandle_t * const pxCreatedTask,
+                                               const TickType_t xPeriod,
+                                               const TickType_t xRelativeDeadline,
+                                               const TickType_t xWCET,
+                                               const TickType_t xPhase )
+    {
         TCB_t * pxNewTCB;
         BaseType_t xReturn;
 
+        /* A constrained deadline task must be due no later than the end of its
+         * period, and a job cannot need more time than its deadline allows. */
+        configASSERT( xPeriod > ( TickType_t ) 0U );
+        configASSERT( ( xRelativeDeadline > ( TickType_t ) 0U ) && ( xRelativeDeadline <= xPeriod ) );
+        configASSERT( xWCET <= xRelativeDeadline );
+
+        #if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+            {
+                /* Admit the task before anything is allocated. */
+                if( prvEDFAdmitNewTask( xPeriod, xRelativeDeadline, xWCET ) != pdPASS )
+                {
+                    traceTASK_CREATE_FAILED();
+                    return errTASK_NOT_SCHEDULABLE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_EDF_ADMISSION_CONTROL */
+
         /* If the stack grows down then allocate the stack then the TCB so the stack
          * does not grow into the TCB.  Likewise if the stack grows up then allocate
          * the TCB then the stack. */
@@ -915,69 +2092,246 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             #endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
 
             prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
-			
-						/*E.C. : initialize the period */
-						pxNewTCB->xTaskPeriod = period; /* Initialize the period */
-								
-						/*E.C. : insert the period value in the xStateListItem before to add the task in RL: */
-						listSET_LIST_ITEM_VALUE(&(pxNewTCB->xStateListItem), pxNewTCB->xTaskPeriod + xTaskGetTickCount());
-					
+            prvEDFInitialisePeriodicTask( pxNewTCB, xPeriod, xRelativeDeadline, xWCET, xPhase );
             prvAddNewTaskToReadyList( pxNewTCB );
             xReturn = pdPASS;
-				}
-				else
-				{
-						xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
-				}
+        }
+        else
+        {
+            #if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+                {
+                    /* The task was admitted but cannot be created. */
+                    prvEDFUnadmitNewTask( xPeriod, xRelativeDeadline, xWCET );
+                }
+            #endif
 
-				return xReturn;
+            xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+		BaseType_t xTaskPeriodicCreate( TaskFunction_t pxTaskCode,
+													const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+													const configSTACK_DEPTH_TYPE usStackDepth,
+													void * const pvParameters,
+													UBaseType_t uxPriority,
+													TaskHandle_t * const pxCreatedTask, 
+													TickType_t period )
+		{
+				/* An implicit deadline task: due at the end of its period, no WCET
+				 * estimate and released as soon as it is created. */
+				return xTaskPeriodicCreateConstrained( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask,
+																							 period, period, ( TickType_t ) 0U, ( TickType_t ) 0U );
 		}
 		#endif /* xTaskPeriodicCreate() */
 
-													
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SHARED_STACK == 1 ) )
+
+    BaseType_t xTaskPeriodicCreateShared( TaskFunction_t pxJobCode,
+                                          const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                          void * const pvParameters,
+                                          UBaseType_t uxPriority,
+                                          TaskHandle_t * const pxCreatedTask,
+                                          const TickType_t xPeriod,
+                                          const TickType_t xRelativeDeadline,
+                                          const TickType_t xWCET,
+                                          const TickType_t xPhase )
+    {
+        TCB_t * pxNewTCB;
+        BaseType_t xReturn;
 
-#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
-/*-----------------------------------------------------------*/
+        configASSERT( pxJobCode );
+        configASSERT( xPeriod > ( TickType_t ) 0U );
+        configASSERT( ( xRelativeDeadline > ( TickType_t ) 0U ) && ( xRelativeDeadline <= xPeriod ) );
+        configASSERT( xWCET <= xRelativeDeadline );
 
-static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
-                                  const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-                                  const uint32_t ulStackDepth,
-                                  void * const pvParameters,
-                                  UBaseType_t uxPriority,
-                                  TaskHandle_t * const pxCreatedTask,
-                                  TCB_t * pxNewTCB,
-                                  const MemoryRegion_t * const xRegions )
-{
-    StackType_t * pxTopOfStack;
-    UBaseType_t x;
+        #if ( ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 ) && ( configEDF_BUDGET_OVERRUN_ACTION != tskEDF_BUDGET_NOTIFY ) )
+            {
+                /* Throttling or demoting a job would let the jobs that start
+                 * above it on the shared stack run before it completes. */
+                if( xWCET != ( TickType_t ) 0U )
+                {
+                    traceTASK_CREATE_FAILED();
+                    return pdFAIL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
 
-    #if ( portUSING_MPU_WRAPPERS == 1 )
-        /* Should the task be created in privileged mode? */
-        BaseType_t xRunPrivileged;
+        #if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+            {
+                if( prvEDFAdmitNewTask( xPeriod, xRelativeDeadline, xWCET ) != pdPASS )
+                {
+                    traceTASK_CREATE_FAILED();
+                    return errTASK_NOT_SCHEDULABLE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_EDF_ADMISSION_CONTROL */
 
-        if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
+        /* Only the TCB is allocated.  The task runs on the shared stack. */
+        pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+
+        if( pxNewTCB != NULL )
         {
-            xRunPrivileged = pdTRUE;
+            pxNewTCB->pxStack = xEDFSharedStack;
+
+            #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e9029 !e731 Macro has been consolidated for readability reasons. */
+                {
+                    /* The stack must not be freed if the task is deleted. */
+                    pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_ONLY;
+                }
+            #endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+
+            prvInitialiseNewTask( prvEDFSharedStackJob, pcName, configEDF_SHARED_STACK_DEPTH, pxNewTCB, uxPriority, pxCreatedTask, pxNewTCB, NULL );
+            pxNewTCB->pxJobCode = pxJobCode;
+            pxNewTCB->pvJobParameters = pvParameters;
+            prvEDFInitialisePeriodicTask( pxNewTCB, xPeriod, xRelativeDeadline, xWCET, xPhase );
+            prvAddNewTaskToReadyList( pxNewTCB );
+            xReturn = pdPASS;
         }
         else
         {
-            xRunPrivileged = pdFALSE;
-        }
-        uxPriority &= ~portPRIVILEGE_BIT;
-    #endif /* portUSING_MPU_WRAPPERS == 1 */
+            #if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+                {
+                    /* The task was admitted but cannot be created. */
+                    prvEDFUnadmitNewTask( xPeriod, xRelativeDeadline, xWCET );
+                }
+            #endif
 
-    /* Avoid dependency on memset() if it is not required. */
-    #if ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
-        {
-            /* Fill the stack with a known value to assist debugging. */
-            ( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
+            xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
         }
-    #endif /* tskSET_NEW_STACKS_TO_KNOWN_VALUE */
 
-    /* Calculate the top of stack address.  This depends on whether the stack
-     * grows from high memory to low (as per the 80x86) or vice versa.
-     * portSTACK_GROWTH is used to make the result positive or negative as required
-     * by the port. */
+        return xReturn;
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SHARED_STACK == 1 ) */
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_CBS == 1 ) )
+
+    BaseType_t xTaskCBSCreate( TaskFunction_t pxTaskCode,
+                               const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                               const configSTACK_DEPTH_TYPE usStackDepth,
+                               void * const pvParameters,
+                               UBaseType_t uxPriority,
+                               TaskHandle_t * const pxCreatedTask,
+                               const TickType_t xBudget,
+                               const TickType_t xPeriod )
+    {
+        TaskHandle_t xCreatedTask = NULL;
+        BaseType_t xReturn, xYieldRequired;
+
+        configASSERT( ( xBudget > ( TickType_t ) 0U ) && ( xBudget <= xPeriod ) );
+
+        /* The scheduler is suspended from before the task is created until it
+         * is a server, so it cannot run in between as an ordinary task.  A
+         * yield asked for by the creation is held until xTaskResumeAll(). */
+        vTaskSuspendAll();
+        {
+            /* The server is admitted as a task with a period and relative
+             * deadline of xPeriod and a WCET of xBudget, which is the most it
+             * can ask for. */
+            xReturn = xTaskPeriodicCreateConstrained( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, &xCreatedTask,
+                                                      xPeriod, xPeriod, xBudget, ( TickType_t ) 0U );
+
+            if( xReturn == pdPASS )
+            {
+                xYieldRequired = prvEDFCBSStart( xCreatedTask, xBudget, xPeriod );
+            }
+            else
+            {
+                xYieldRequired = pdFALSE;
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        if( xReturn == pdPASS )
+        {
+            if( xYieldRequired != pdFALSE )
+            {
+                taskYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxCreatedTask != NULL )
+            {
+                *pxCreatedTask = xCreatedTask;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_CBS == 1 ) */
+
+													
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
+                                  const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                  const uint32_t ulStackDepth,
+                                  void * const pvParameters,
+                                  UBaseType_t uxPriority,
+                                  TaskHandle_t * const pxCreatedTask,
+                                  TCB_t * pxNewTCB,
+                                  const MemoryRegion_t * const xRegions )
+{
+    StackType_t * pxTopOfStack;
+    UBaseType_t x;
+
+    #if ( portUSING_MPU_WRAPPERS == 1 )
+        /* Should the task be created in privileged mode? */
+        BaseType_t xRunPrivileged;
+
+        if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
+        {
+            xRunPrivileged = pdTRUE;
+        }
+        else
+        {
+            xRunPrivileged = pdFALSE;
+        }
+        uxPriority &= ~portPRIVILEGE_BIT;
+    #endif /* portUSING_MPU_WRAPPERS == 1 */
+
+    /* Avoid dependency on memset() if it is not required. */
+    #if ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
+        {
+            /* Fill the stack with a known value to assist debugging.  The
+             * shared stack is filled once, when the task lists are
+             * initialised, as jobs may already be using it. */
+            if( taskEDF_STACK_IS_SHARED( pxNewTCB ) == pdFALSE )
+            {
+                ( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
+            }
+        }
+    #endif /* tskSET_NEW_STACKS_TO_KNOWN_VALUE */
+
+    /* Calculate the top of stack address.  This depends on whether the stack
+     * grows from high memory to low (as per the 80x86) or vice versa.
+     * portSTACK_GROWTH is used to make the result positive or negative as required
+     * by the port. */
     #if ( portSTACK_GROWTH < 0 )
         {
             pxTopOfStack = &( pxNewTCB->pxStack[ ulStackDepth - ( uint32_t ) 1 ] );
@@ -1061,6 +2415,18 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
     vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
     vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
 
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_HEAP_READY_QUEUE == 1 ) )
+        {
+            pxNewTCB->uxEDFHeapIndex = taskEDF_HEAP_INDEX_NONE;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BUCKET_READY_QUEUE == 1 ) )
+        {
+            pxNewTCB->uxEDFBucket = taskEDF_BUCKET_NONE;
+        }
+    #endif
+
     /* Set the pxNewTCB as a link back from the ListItem_t.  This is so we can get
      * back to  the containing TCB from a generic item in a list. */
     listSET_LIST_ITEM_OWNER( &( pxNewTCB->xStateListItem ), pxNewTCB );
@@ -1126,57 +2492,132 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
         }
     #endif
 
-    /* Initialize the TCB stack to look as if the task was already running,
-     * but had been interrupted by the scheduler.  The return address is set
-     * to the start of the task function. Once the stack has been initialised
-     * the top of stack variable is updated. */
-    #if ( portUSING_MPU_WRAPPERS == 1 )
+    #if ( configUSE_EDF_SCHEDULER == 1 )
         {
-            /* If the port has capability to detect stack overflow,
-             * pass the stack end address to the stack initialization
-             * function as well. */
-            #if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
-                {
-                    #if ( portSTACK_GROWTH < 0 )
-                        {
-                            pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters, xRunPrivileged );
-                        }
-                    #else /* portSTACK_GROWTH */
-                        {
-                            pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters, xRunPrivileged );
-                        }
-                    #endif /* portSTACK_GROWTH */
-                }
-            #else /* portHAS_STACK_OVERFLOW_CHECKING */
-                {
-                    pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
-                }
-            #endif /* portHAS_STACK_OVERFLOW_CHECKING */
+            pxNewTCB->xEventListItemOnDeadline = pdFALSE;
+
+            /* A task created by xTaskCreate() or xTaskCreateStatic(), such as
+             * the idle task, has no period and is released at once.
+             * xTaskPeriodicCreateConstrained() sets the real parameters. */
+            prvEDFInitialisePeriodicTask( pxNewTCB, ( TickType_t ) 0U, ( TickType_t ) 0U, ( TickType_t ) 0U, ( TickType_t ) 0U );
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DEADLINE_MISS_DETECTION == 1 ) )
+        {
+            pxNewTCB->xDeadlineMissed = pdFALSE;
+            pxNewTCB->uxDeadlineMisses = ( UBaseType_t ) 0U;
+            pxNewTCB->xMaxLateness = ( TickType_t ) 0U;
+            pxNewTCB->ulTotalLateness = 0UL;
         }
-    #else /* portUSING_MPU_WRAPPERS */
+    #endif
+
+    #if ( configUSE_EDF_JOB_RECORDS == 1 )
         {
-            /* If the port has capability to detect stack overflow,
-             * pass the stack end address to the stack initialization
-             * function as well. */
-            #if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
-                {
-                    #if ( portSTACK_GROWTH < 0 )
-                        {
-                            pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters );
-                        }
-                    #else /* portSTACK_GROWTH */
-                        {
-                            pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters );
-                        }
-                    #endif /* portSTACK_GROWTH */
-                }
-            #else /* portHAS_STACK_OVERFLOW_CHECKING */
-                {
-                    pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
-                }
-            #endif /* portHAS_STACK_OVERFLOW_CHECKING */
+            pxNewTCB->ulJobStartTime = 0UL;
+            pxNewTCB->xJobStarted = pdFALSE;
+            pxNewTCB->uxJobPreemptions = ( UBaseType_t ) 0U;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 ) )
+        {
+            pxNewTCB->ulBudgetUsed = 0UL;
+            pxNewTCB->xBudgetExhausted = pdFALSE;
+            pxNewTCB->uxBudgetOverruns = ( UBaseType_t ) 0U;
         }
-    #endif /* portUSING_MPU_WRAPPERS */
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_CBS == 1 ) )
+        {
+            pxNewTCB->xCBSServer = pdFALSE;
+            pxNewTCB->xCBSActive = pdFALSE;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) )
+        {
+            pxNewTCB->uxSRPResourcesHeld = ( UBaseType_t ) 0U;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DEADLINE_INHERITANCE == 1 ) )
+        {
+            pxNewTCB->xInheritedDeadline = ( TickType_t ) 0U;
+            pxNewTCB->xDeadlineInherited = pdFALSE;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SHARED_STACK == 1 ) )
+        {
+            pxNewTCB->pxJobCode = NULL;
+            pxNewTCB->pvJobParameters = NULL;
+            pxNewTCB->pxSharedStackPrevious = NULL;
+            pxNewTCB->uxSharedStackJob = taskEDF_JOB_NOT_STARTED;
+        }
+    #endif
+
+    /* Initialize the TCB stack to look as if the task was already running,
+     * but had been interrupted by the scheduler.  The return address is set
+     * to the start of the task function. Once the stack has been initialised
+     * the top of stack variable is updated. */
+    if( taskEDF_STACK_IS_SHARED( pxNewTCB ) != pdFALSE )
+    {
+        /* Where the job of the task starts on the shared stack depends on
+         * the jobs it preempts, so its stack is only initialised when the
+         * job first runs. */
+        pxNewTCB->pxTopOfStack = NULL;
+    }
+    else
+    {
+        #if ( portUSING_MPU_WRAPPERS == 1 )
+            {
+                /* If the port has capability to detect stack overflow,
+                 * pass the stack end address to the stack initialization
+                 * function as well. */
+                #if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
+                    {
+                        #if ( portSTACK_GROWTH < 0 )
+                            {
+                                pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters, xRunPrivileged );
+                            }
+                        #else /* portSTACK_GROWTH */
+                            {
+                                pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+                            }
+                        #endif /* portSTACK_GROWTH */
+                    }
+                #else /* portHAS_STACK_OVERFLOW_CHECKING */
+                    {
+                        pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+                    }
+                #endif /* portHAS_STACK_OVERFLOW_CHECKING */
+            }
+        #else /* portUSING_MPU_WRAPPERS */
+            {
+                /* If the port has capability to detect stack overflow,
+                 * pass the stack end address to the stack initialization
+                 * function as well. */
+                #if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
+                    {
+                        #if ( portSTACK_GROWTH < 0 )
+                            {
+                                pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters );
+                            }
+                        #else /* portSTACK_GROWTH */
+                            {
+                                pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters );
+                            }
+                        #endif /* portSTACK_GROWTH */
+                    }
+                #else /* portHAS_STACK_OVERFLOW_CHECKING */
+                    {
+                        pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
+                    }
+                #endif /* portHAS_STACK_OVERFLOW_CHECKING */
+            }
+        #endif /* portUSING_MPU_WRAPPERS */
+    }
 
     if( pxCreatedTask != NULL )
     {
@@ -1234,7 +2675,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 											mtCOVERAGE_TEST_MARKER();
 									}
 								#else
-									if( pxCurrentTCB->xStateListItem.xItemValue > pxNewTCB->xStateListItem.xItemValue )
+									if( taskEDF_DEADLINE( pxCurrentTCB ) > taskEDF_DEADLINE( pxNewTCB ) )
 									{
 											pxCurrentTCB = pxNewTCB;
 									}
@@ -1260,7 +2701,23 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
         #endif /* configUSE_TRACE_FACILITY */
         traceTASK_CREATE( pxNewTCB );
 
-        prvAddTaskToReadyList( pxNewTCB );
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                /* A task with a phase is not Ready until its first release. */
+                if( pxNewTCB->xPhase != ( TickType_t ) 0U )
+                {
+                    prvAddNewTaskToDelayedList( pxNewTCB );
+                }
+                else
+                {
+                    prvAddTaskToReadyList( pxNewTCB );
+                }
+            }
+        #else
+            {
+                prvAddTaskToReadyList( pxNewTCB );
+            }
+        #endif
 
         portSETUP_TCB( pxNewTCB );
     }
@@ -1270,7 +2727,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
     {
         /* If the created task is of a higher priority than the current task
          * then it should run now. */
-        if( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority )
+        if( taskWOKEN_TASK_PREEMPTS( pxNewTCB, ( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority ) ) != pdFALSE )
         {
             taskYIELD_IF_USING_PREEMPTION();
         }
@@ -1308,6 +2765,8 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 mtCOVERAGE_TEST_MARKER();
             }
 
+            taskEDF_RESET_READY_QUEUE( pxTCB );
+
             /* Is the task waiting on an event also? */
             if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
             {
@@ -1318,6 +2777,35 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 mtCOVERAGE_TEST_MARKER();
             }
 
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SHARED_STACK == 1 ) )
+                {
+                    /* Nothing may reach the TCB through the chain of jobs on
+                     * the shared stack once it has been freed. */
+                    if( pxTCB->uxSharedStackJob != taskEDF_JOB_NOT_STARTED )
+                    {
+                        prvEDFSharedStackUnlink( pxTCB );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif
+
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_ADMISSION_CONTROL == 1 ) )
+                {
+                    /* The processor time of the task is free for new tasks. */
+                    if( pxTCB->xWCET != ( TickType_t ) 0U )
+                    {
+                        prvEDFAdmissionRemove( pxTCB->xTaskPeriod, pxTCB->xRelativeDeadline, pxTCB->xWCET );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif
+
             /* Increment the uxTaskNumber also so kernel aware debuggers can
              * detect that the task lists need re-generating.  This is done before
              * portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
@@ -1404,19 +2892,24 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
         {
             /* Minor optimisation.  The tick count cannot change in this
              * block. */
-            const TickType_t xConstTickCount = xTickCount;
+            const TickType_t xConstTickCount = taskTICK_COUNT_NOW();
+
+            /* The wake times of EDF tasks are release times, which are kept
+             * in EDF time rather than in ticks if configUSE_EDF_FINE_TIME is
+             * set. */
+            const TickType_t xTimeNow = taskEDF_TIME_NOW( xConstTickCount );
 
             /* Generate the tick time at which the task wants to wake. */
             xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
 
-            if( xConstTickCount < *pxPreviousWakeTime )
+            if( xTimeNow < *pxPreviousWakeTime )
             {
                 /* The tick count has overflowed since this function was
                  * lasted called.  In this case the only time we should ever
                  * actually delay is if the wake time has also  overflowed,
                  * and the wake time is greater than the tick time.  When this
                  * is the case it is as if neither time had overflowed. */
-                if( ( xTimeToWake < *pxPreviousWakeTime ) && ( xTimeToWake > xConstTickCount ) )
+                if( ( xTimeToWake < *pxPreviousWakeTime ) && ( xTimeToWake > xTimeNow ) )
                 {
                     xShouldDelay = pdTRUE;
                 }
@@ -1430,7 +2923,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 /* The tick time has not overflowed.  In this case we will
                  * delay if either the wake time has overflowed, and/or the
                  * tick time is less than the wake time. */
-                if( ( xTimeToWake < *pxPreviousWakeTime ) || ( xTimeToWake > xConstTickCount ) )
+                if( ( xTimeToWake < *pxPreviousWakeTime ) || ( xTimeToWake > xTimeNow ) )
                 {
                     xShouldDelay = pdTRUE;
                 }
@@ -1443,17 +2936,103 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
             /* Update the wake time ready for the next call. */
             *pxPreviousWakeTime = xTimeToWake;
 
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DEADLINE_MISS_DETECTION == 1 ) )
+                {
+                    /* The current job is complete.  Account for its lateness,
+                     * reporting the miss now if the tick did not see it. */
+                    const TickType_t xLateness = xTimeNow - pxCurrentTCB->xAbsoluteDeadline;
+
+                    if( taskEDF_TICK_IS_AFTER( xTimeNow, pxCurrentTCB->xAbsoluteDeadline ) )
+                    {
+                        prvEDFDeadlineMissed( pxCurrentTCB, xTimeNow );
+
+                        if( xLateness > pxCurrentTCB->xMaxLateness )
+                        {
+                            pxCurrentTCB->xMaxLateness = xLateness;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        pxCurrentTCB->ulTotalLateness += ( uint32_t ) xLateness;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    pxCurrentTCB->xDeadlineMissed = pdFALSE;
+                }
+            #endif
+
+            #if ( configUSE_EDF_JOB_RECORDS == 1 )
+                {
+                    prvEDFRecordJob( xTimeNow );
+                }
+            #endif
+
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 ) )
+                {
+                    if( taskEDF_TICK_IS_AFTER( xTimeToWake, pxCurrentTCB->xReleaseTime ) )
+                    {
+                        taskEDF_NEW_BUDGET();
+                    }
+                    else
+                    {
+                        /* The job overran and was already moved on to a
+                         * release at or after xTimeToWake, with the budget for
+                         * it.  The next job must wait for that release and use
+                         * what is left of that budget, otherwise the task
+                         * would get two budgets in one period. */
+                        xTimeToWake = pxCurrentTCB->xReleaseTime;
+                        xShouldDelay = taskEDF_TICK_IS_AFTER( xTimeToWake, xTimeNow );
+                    }
+                }
+            #endif
+
+            #if ( configUSE_EDF_SCHEDULER == 1 )
+                {
+                    /* The next job of the task is released at xTimeToWake.  Its
+                     * deadline is set here, once, rather than each time the
+                     * task leaves the Blocked state. */
+                    pxCurrentTCB->xReleaseTime = xTimeToWake;
+                    pxCurrentTCB->xAbsoluteDeadline = xTimeToWake + pxCurrentTCB->xRelativeDeadline;
+                }
+            #endif
+
             if( xShouldDelay != pdFALSE )
             {
                 traceTASK_DELAY_UNTIL( xTimeToWake );
 
                 /* prvAddCurrentTaskToDelayedList() needs the block time, not
                  * the time to wake, so subtract the current tick count. */
-                prvAddCurrentTaskToDelayedList( xTimeToWake - xConstTickCount, pdFALSE );
+                prvAddCurrentTaskToDelayedList( taskEDF_TICKS_UNTIL( xTimeToWake, xConstTickCount ), pdFALSE );
             }
             else
             {
-                mtCOVERAGE_TEST_MARKER();
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    {
+                        /* The next job has already been released, so the task
+                         * stays Ready but must be queued again under its new
+                         * deadline. */
+                        ( void ) uxListRemove( &( pxCurrentTCB->xStateListItem ) );
+                        taskEDF_RESET_READY_QUEUE( pxCurrentTCB );
+                        prvAddTaskToReadyList( pxCurrentTCB );
+
+                        #if ( configUSE_EDF_JOB_RECORDS == 1 )
+                            {
+                                /* The next job starts now, unless it is
+                                 * preempted before the scheduler is resumed. */
+                                taskEDF_JOB_DISPATCHED();
+                            }
+                        #endif
+                    }
+                #else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                #endif
             }
         }
         xAlreadyYielded = xTaskResumeAll();
@@ -1545,7 +3124,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
             }
             taskEXIT_CRITICAL();
 
-            if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+            if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) || ( taskIS_TIMING_WHEEL_SLOT( pxStateList ) != pdFALSE ) )
             {
                 /* The task being queried is referenced from one of the Blocked
                  * lists. */
@@ -1788,7 +3367,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 
                 /* Only reset the event list item value if the value is not
                  * being used for anything else. */
-                if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+                if( taskEVENT_LIST_ITEM_VALUE_IS_PRIORITY( pxTCB ) )
                 {
                     listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
                 }
@@ -1870,6 +3449,14 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 mtCOVERAGE_TEST_MARKER();
             }
 
+            taskEDF_RESET_READY_QUEUE( pxTCB );
+
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_CBS == 1 ) )
+                {
+                    pxTCB->xCBSActive = pdFALSE;
+                }
+            #endif
+
             /* Is the task waiting on an event also? */
             if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
             {
@@ -2022,7 +3609,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                     prvAddTaskToReadyList( pxTCB );
 
                     /* A higher priority task may have just been resumed. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    if( taskWOKEN_TASK_PREEMPTS( pxTCB, ( pxTCB->uxPriority >= pxCurrentTCB->uxPriority ) ) != pdFALSE )
                     {
                         /* This yield may not cause the task just resumed to run,
                          * but will leave the lists in the correct state for the
@@ -2089,8 +3676,12 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
                 {
                     /* Ready lists can be accessed so move the task from the
-                     * suspended list to the ready list directly. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                     * suspended list to the ready list directly.  Under EDF it
+                     * must be queued before the deadlines are compared. */
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                    prvAddWokenTaskToReadyList( pxTCB );
+
+                    if( taskWOKEN_TASK_PREEMPTS( pxTCB, ( pxTCB->uxPriority >= pxCurrentTCB->uxPriority ) ) != pdFALSE )
                     {
                         xYieldRequired = pdTRUE;
 
@@ -2103,9 +3694,6 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
-
-                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
                 }
                 else
                 {
@@ -2162,26 +3750,36 @@ void vTaskStartScheduler( void )
     #else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
         {
             /* The Idle task is being created using dynamically allocated RAM. */
-						
-						#if (configUSE_EDF_SCHEDULER == 1)
-						xReturn = xTaskPeriodicCreate( prvIdleTask,
-															configIDLE_TASK_NAME,
-															configMINIMAL_STACK_SIZE,
-															( void * ) NULL,
-															portPRIVILEGE_BIT,  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
-															&xIdleTaskHandle, /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
-															IDLE_PERIOD);
-						#else
-									xReturn = xTaskCreate( prvIdleTask,
-																				 configIDLE_TASK_NAME,
-																				 configMINIMAL_STACK_SIZE,
-																				 ( void * ) NULL,
-																				 portPRIVILEGE_BIT,  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
-																				 &xIdleTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
-						#endif
-	      }
+            xReturn = xTaskCreate( prvIdleTask,
+                                   configIDLE_TASK_NAME,
+                                   configMINIMAL_STACK_SIZE,
+                                   ( void * ) NULL,
+                                   portPRIVILEGE_BIT,  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+                                   &xIdleTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+        }
     #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        {
+            if( xReturn == pdPASS )
+            {
+                /* The idle task was added to the ready queue like any other
+                 * task.  Take it out again, as it runs only when the queue is
+                 * empty. */
+                taskENTER_CRITICAL();
+                {
+                    ( void ) uxListRemove( &( xIdleTaskHandle->xStateListItem ) );
+                    taskEDF_RESET_READY_QUEUE( xIdleTaskHandle );
+                }
+                taskEXIT_CRITICAL();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif
+
     #if ( configUSE_TIMERS == 1 )
         {
             if( xReturn == pdPASS )
@@ -2223,10 +3821,57 @@ void vTaskStartScheduler( void )
             }
         #endif /* configUSE_NEWLIB_REENTRANT */
 
-        xNextTaskUnblockTime = portMAX_DELAY;
         xSchedulerRunning = pdTRUE;
         xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
 
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                /* Tasks created with a phase are already in the delayed list,
+                 * waiting for their first release, and the task chosen as
+                 * pxCurrentTCB when it was created may be one of them.  Start
+                 * with the Ready task that has the earliest deadline. */
+                #if ( configUSE_EDF_FINE_TIME == 1 ) || ( configUSE_EDF_EVENT_TICK == 1 )
+                    {
+                        ulEDFCounterAtTick = ( uint32_t ) portEDF_GET_BUDGET_COUNTER();
+                    }
+                #endif
+
+                xEDFReleaseEpoch = taskEDF_TIME_FROM_TICKS( xTickCount );
+                prvResetNextTaskUnblockTime();
+                taskSELECT_EARLIEST_DEADLINE_TASK();
+
+                #if ( configUSE_EDF_SHARED_STACK == 1 )
+                    {
+                        prvEDFSharedStackDispatch();
+                    }
+                #endif
+
+                #if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+                    {
+                        /* The first task starts its first job now. */
+                        taskEDF_NEW_BUDGET();
+                    }
+                #endif
+
+                #if ( configUSE_EDF_JOB_RECORDS == 1 )
+                    {
+                        taskEDF_JOB_DISPATCHED();
+                    }
+                #endif
+
+                #if ( configUSE_EDF_EVENT_TICK == 1 )
+                    {
+                        /* There is no periodic tick to start. */
+                        prvEDFSetNextEvent();
+                    }
+                #endif
+            }
+        #else
+            {
+                xNextTaskUnblockTime = portMAX_DELAY;
+            }
+        #endif
+
         /* If configGENERATE_RUN_TIME_STATS is defined then the following
          * macro must be defined to configure the timer/counter used to generate
          * the run time counter time base.   NOTE:  If configGENERATE_RUN_TIME_STATS
@@ -2333,6 +3978,25 @@ void vTaskSuspendAll( void )
             }
         #endif /* if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) */
 
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                /* The ready queue only holds jobs that have been released and
+                 * not completed, and the idle task is returned as the earliest
+                 * deadline task only when it is empty.  The tasks that are
+                 * neither Ready nor Suspended wait in the delayed lists for the
+                 * release of their next job or for a timeout, so no tick needs
+                 * processing before xNextTaskUnblockTime. */
+                if( taskEDF_GET_EARLIEST_DEADLINE_TASK() != pxCurrentTCB )
+                {
+                    uxHigherPriorityReadyTasks = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
         if( pxCurrentTCB->uxPriority > tskIDLE_PRIORITY )
         {
             xReturn = 0;
@@ -2396,7 +4060,7 @@ BaseType_t xTaskResumeAll( void )
 
                     /* If the moved task has a priority higher than or equal to
                      * the current task then a yield must be performed. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    if( taskWOKEN_TASK_PREEMPTS( pxTCB, ( pxTCB->uxPriority >= pxCurrentTCB->uxPriority ) ) != pdFALSE )
                     {
                         xYieldPending = pdTRUE;
                     }
@@ -2478,12 +4142,25 @@ TickType_t xTaskGetTickCount( void )
 {
     TickType_t xTicks;
 
-    /* Critical section required if running on a 16 bit processor. */
-    portTICK_TYPE_ENTER_CRITICAL();
-    {
-        xTicks = xTickCount;
-    }
-    portTICK_TYPE_EXIT_CRITICAL();
+    #if ( configUSE_EDF_EVENT_TICK == 1 )
+        {
+            /* The counter and the ticks counted must be read together. */
+            taskENTER_CRITICAL();
+            {
+                xTicks = taskTICK_COUNT_NOW();
+            }
+            taskEXIT_CRITICAL();
+        }
+    #else
+        {
+            /* Critical section required if running on a 16 bit processor. */
+            portTICK_TYPE_ENTER_CRITICAL();
+            {
+                xTicks = xTickCount;
+            }
+            portTICK_TYPE_EXIT_CRITICAL();
+        }
+    #endif
 
     return xTicks;
 }
@@ -2510,436 +4187,1012 @@ TickType_t xTaskGetTickCountFromISR( void )
      * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
     portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
-    uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
-    {
-        xReturn = xTickCount;
-    }
-    portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    #if ( configUSE_EDF_EVENT_TICK == 1 )
+        {
+            uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+            {
+                xReturn = taskTICK_COUNT_NOW();
+            }
+            portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+        }
+    #else
+        {
+            uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
+            {
+                xReturn = xTickCount;
+            }
+            portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+        }
+    #endif
 
     return xReturn;
 }
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxTaskGetNumberOfTasks( void )
-{
-    /* A critical section is not required because the variables are of type
-     * BaseType_t. */
-    return uxCurrentNumberOfTasks;
-}
-/*-----------------------------------------------------------*/
-
-char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-{
-    TCB_t * pxTCB;
-
-    /* If null is passed in here then the name of the calling task is being
-     * queried. */
-    pxTCB = prvGetTCBFromHandle( xTaskToQuery );
-    configASSERT( pxTCB );
-    return &( pxTCB->pcTaskName[ 0 ] );
-}
-/*-----------------------------------------------------------*/
-
-#if ( INCLUDE_xTaskGetHandle == 1 )
+#if ( configUSE_EDF_SCHEDULER == 1 )
 
-    static TCB_t * prvSearchForNameWithinSingleList( List_t * pxList,
-                                                     const char pcNameToQuery[] )
+    TickType_t xTaskGetReleaseTime( TaskHandle_t xTask )
     {
-        TCB_t * pxNextTCB, * pxFirstTCB, * pxReturn = NULL;
-        UBaseType_t x;
-        char cNextChar;
-        BaseType_t xBreakLoop;
-
-        /* This function is called with the scheduler suspended. */
+        TCB_t const * pxTCB;
+        TickType_t xReturn;
 
-        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+        /* The release time is updated by the task itself when it releases its
+         * next job, so a critical section is only needed when the tick type
+         * cannot be read atomically. */
+        portTICK_TYPE_ENTER_CRITICAL();
         {
-            listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+            /* If null is passed in here then the release time of the calling
+             * task is being queried. */
+            pxTCB = prvGetTCBFromHandle( xTask );
+            xReturn = pxTCB->xReleaseTime;
+        }
+        portTICK_TYPE_EXIT_CRITICAL();
 
-            do
-            {
-                listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+        return xReturn;
+    }
 
-                /* Check each character in the name looking for a match or
-                 * mismatch. */
-                xBreakLoop = pdFALSE;
+#endif /* configUSE_EDF_SCHEDULER */
+/*-----------------------------------------------------------*/
 
-                for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
-                {
-                    cNextChar = pxNextTCB->pcTaskName[ x ];
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_ADMISSION_CONTROL == 1 ) )
 
-                    if( cNextChar != pcNameToQuery[ x ] )
-                    {
-                        /* Characters didn't match. */
-                        xBreakLoop = pdTRUE;
-                    }
-                    else if( cNextChar == ( char ) 0x00 )
-                    {
-                        /* Both strings terminated, a match must have been
-                         * found. */
-                        pxReturn = pxNextTCB;
-                        xBreakLoop = pdTRUE;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+    BaseType_t xTaskCheckSchedulability( const TickType_t xPeriod,
+                                         const TickType_t xRelativeDeadline,
+                                         const TickType_t xWCET,
+                                         TickType_t * const pxFailingInterval )
+    {
+        BaseType_t xReturn;
 
-                    if( xBreakLoop != pdFALSE )
-                    {
-                        break;
-                    }
-                }
+        configASSERT( xPeriod > ( TickType_t ) 0U );
+        configASSERT( ( xRelativeDeadline > ( TickType_t ) 0U ) && ( xRelativeDeadline <= xPeriod ) );
 
-                if( pxReturn != NULL )
-                {
-                    /* The handle has been found. */
-                    break;
-                }
-            } while( pxNextTCB != pxFirstTCB );
-        }
-        else
+        vTaskSuspendAll();
         {
-            mtCOVERAGE_TEST_MARKER();
+            /* The candidate is not admitted, so is forgotten again as soon as
+             * the scheduler is resumed. */
+            xReturn = prvEDFAdmissionTest( xPeriod, xRelativeDeadline, xWCET, pxFailingInterval );
         }
+        ( void ) xTaskResumeAll();
 
-        return pxReturn;
+        return xReturn;
     }
 
-#endif /* INCLUDE_xTaskGetHandle */
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_ADMISSION_CONTROL == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetHandle == 1 )
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DEADLINE_MISS_DETECTION == 1 ) )
 
-    TaskHandle_t xTaskGetHandle( const char * pcNameToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+    void vTaskGetDeadlineMissStats( TaskHandle_t xTask,
+                                    UBaseType_t * const puxMisses,
+                                    TickType_t * const pxMaxLateness,
+                                    uint32_t * const pulTotalLateness )
     {
-        UBaseType_t uxQueue = configMAX_PRIORITIES;
-        TCB_t * pxTCB;
-
-        /* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
-        configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
+        TCB_t const * pxTCB;
 
-        vTaskSuspendAll();
+        taskENTER_CRITICAL();
         {
-            /* Search the ready lists. */
-            do
+            /* If null is passed in here then the calling task is being
+             * queried. */
+            pxTCB = prvGetTCBFromHandle( xTask );
+
+            if( puxMisses != NULL )
             {
-                uxQueue--;
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
+                *puxMisses = pxTCB->uxDeadlineMisses;
+            }
 
-                if( pxTCB != NULL )
-                {
-                    /* Found the handle. */
-                    break;
-                }
-            } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+            if( pxMaxLateness != NULL )
+            {
+                *pxMaxLateness = pxTCB->xMaxLateness;
+            }
 
-            /* Search the delayed lists. */
-            if( pxTCB == NULL )
+            if( pulTotalLateness != NULL )
             {
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+                *pulTotalLateness = pxTCB->ulTotalLateness;
             }
+        }
+        taskEXIT_CRITICAL();
+    }
 
-            if( pxTCB == NULL )
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DEADLINE_MISS_DETECTION == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    UBaseType_t uxTaskGetAvoidedPreemptionCount( void )
+    {
+        return uxEDFAvoidedPreemptions;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGetTieBreakStats( UBaseType_t * const puxContextSwitches,
+                                UBaseType_t * const puxTiesKept,
+                                UBaseType_t * const puxTieSwitches )
+    {
+        taskENTER_CRITICAL();
+        {
+            if( puxContextSwitches != NULL )
             {
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+                *puxContextSwitches = uxEDFContextSwitches;
             }
 
-            #if ( INCLUDE_vTaskSuspend == 1 )
-                {
-                    if( pxTCB == NULL )
-                    {
-                        /* Search the suspended list. */
-                        pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
-                    }
-                }
-            #endif
+            if( puxTiesKept != NULL )
+            {
+                *puxTiesKept = uxEDFTiesKept;
+            }
 
-            #if ( INCLUDE_vTaskDelete == 1 )
-                {
-                    if( pxTCB == NULL )
-                    {
-                        /* Search the deleted list. */
-                        pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
-                    }
-                }
-            #endif
+            if( puxTieSwitches != NULL )
+            {
+                *puxTieSwitches = uxEDFTieSwitches;
+            }
         }
-        ( void ) xTaskResumeAll();
-
-        return pxTCB;
+        taskEXIT_CRITICAL();
     }
 
-#endif /* INCLUDE_xTaskGetHandle */
+#endif /* configUSE_EDF_SCHEDULER */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( configUSE_EDF_JOB_RECORDS == 1 )
 
-    UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
-                                      const UBaseType_t uxArraySize,
-                                      configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
+    BaseType_t xTaskGetNextJobRecord( TaskHandle_t * const pxTask,
+                                      TickType_t * const pxReleaseTime,
+                                      uint32_t * const pulStartTime,
+                                      uint32_t * const pulFinishTime,
+                                      TickType_t * const pxLateness,
+                                      UBaseType_t * const puxPreemptions )
     {
-        UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+        const UBaseType_t uxTail = uxEDFJobRecordTail;
+        EDFJobRecord_t const * pxRecord;
+        BaseType_t xReturn;
 
-        vTaskSuspendAll();
+        /* Only one task may read the records.  No critical section is needed,
+         * as the kernel does not write to the entry at uxEDFJobRecordTail
+         * until uxEDFJobRecordTail has moved past it. */
+        if( uxTail != uxEDFJobRecordHead )
         {
-            /* Is there a space in the array for each task in the system? */
-            if( uxArraySize >= uxCurrentNumberOfTasks )
+            pxRecord = &( xEDFJobRecords[ uxTail & ( ( UBaseType_t ) configEDF_JOB_RECORD_COUNT - ( UBaseType_t ) 1U ) ] );
+
+            if( pxTask != NULL )
             {
-                /* Fill in an TaskStatus_t structure with information on each
-                 * task in the Ready state. */
-                do
-                {
-                    uxQueue--;
-                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
-                } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                *pxTask = ( TaskHandle_t ) pxRecord->pxTask;
+            }
 
-                /* Fill in an TaskStatus_t structure with information on each
-                 * task in the Blocked state. */
-                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+            if( pxReleaseTime != NULL )
+            {
+                *pxReleaseTime = pxRecord->xReleaseTime;
+            }
 
-                #if ( INCLUDE_vTaskDelete == 1 )
-                    {
-                        /* Fill in an TaskStatus_t structure with information on
-                         * each task that has been deleted but not yet cleaned up. */
-                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, eDeleted );
-                    }
-                #endif
+            if( pulStartTime != NULL )
+            {
+                *pulStartTime = pxRecord->ulStartTime;
+            }
 
-                #if ( INCLUDE_vTaskSuspend == 1 )
-                    {
-                        /* Fill in an TaskStatus_t structure with information on
-                         * each task in the Suspended state. */
-                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xSuspendedTaskList, eSuspended );
-                    }
-                #endif
+            if( pulFinishTime != NULL )
+            {
+                *pulFinishTime = pxRecord->ulFinishTime;
+            }
 
-                #if ( configGENERATE_RUN_TIME_STATS == 1 )
-                    {
-                        if( pulTotalRunTime != NULL )
-                        {
-                            #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-                                portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
-                            #else
-                                *pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-                            #endif
-                        }
-                    }
-                #else /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
-                    {
-                        if( pulTotalRunTime != NULL )
-                        {
-                            *pulTotalRunTime = 0;
-                        }
-                    }
-                #endif /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+            if( pxLateness != NULL )
+            {
+                *pxLateness = pxRecord->xLateness;
             }
-            else
+
+            if( puxPreemptions != NULL )
             {
-                mtCOVERAGE_TEST_MARKER();
+                *puxPreemptions = pxRecord->uxPreemptions;
             }
+
+            /* The entry can be written again once the tail has moved on. */
+            uxEDFJobRecordTail = uxTail + ( UBaseType_t ) 1U;
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
         }
-        ( void ) xTaskResumeAll();
 
-        return uxTask;
+        return xReturn;
     }
+/*-----------------------------------------------------------*/
 
-#endif /* configUSE_TRACE_FACILITY */
-/*----------------------------------------------------------*/
-
-#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
-
-    TaskHandle_t xTaskGetIdleTaskHandle( void )
+    UBaseType_t uxTaskGetLostJobRecordCount( void )
     {
-        /* If xTaskGetIdleTaskHandle() is called before the scheduler has been
-         * started, then xIdleTaskHandle will be NULL. */
-        configASSERT( ( xIdleTaskHandle != NULL ) );
-        return xIdleTaskHandle;
+        return uxEDFJobRecordsLost;
     }
 
-#endif /* INCLUDE_xTaskGetIdleTaskHandle */
-/*----------------------------------------------------------*/
+#endif /* configUSE_EDF_JOB_RECORDS */
+/*-----------------------------------------------------------*/
 
-/* This conditional compilation should use inequality to 0, not equality to 1.
- * This is to ensure vTaskStepTick() is available when user defined low power mode
- * implementations require configUSE_TICKLESS_IDLE to be set to a value other than
- * 1. */
-#if ( configUSE_TICKLESS_IDLE != 0 )
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 ) )
 
-    void vTaskStepTick( const TickType_t xTicksToJump )
+    UBaseType_t uxTaskGetBudgetOverruns( TaskHandle_t xTask )
     {
-        /* Correct the tick count value after a period during which the tick
-         * was suppressed.  Note this does *not* call the tick hook function for
-         * each stepped tick. */
-        configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
-        xTickCount += xTicksToJump;
-        traceINCREASE_TICK_COUNT( xTicksToJump );
-    }
-
-#endif /* configUSE_TICKLESS_IDLE */
-/*----------------------------------------------------------*/
+        TCB_t const * pxTCB;
+        UBaseType_t uxReturn;
 
-BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
-{
-    BaseType_t xYieldOccurred;
+        /* If null is passed in here then the calling task is being queried. */
+        pxTCB = prvGetTCBFromHandle( xTask );
 
-    /* Must not be called with the scheduler suspended as the implementation
-     * relies on xPendedTicks being wound down to 0 in xTaskResumeAll(). */
-    configASSERT( uxSchedulerSuspended == 0 );
+        /* A single word, so no critical section is needed to read it. */
+        uxReturn = pxTCB->uxBudgetOverruns;
 
-    /* Use xPendedTicks to mimic xTicksToCatchUp number of ticks occurring when
-     * the scheduler is suspended so the ticks are executed in xTaskResumeAll(). */
-    vTaskSuspendAll();
-    xPendedTicks += xTicksToCatchUp;
-    xYieldOccurred = xTaskResumeAll();
+        return uxReturn;
+    }
 
-    return xYieldOccurred;
-}
-/*----------------------------------------------------------*/
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 ) */
+/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskAbortDelay == 1 )
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_CBS == 1 ) )
 
-    BaseType_t xTaskAbortDelay( TaskHandle_t xTask )
+    BaseType_t xTaskCBSAttach( TaskHandle_t xTask,
+                               const TickType_t xBudget,
+                               const TickType_t xPeriod )
     {
-        TCB_t * pxTCB = xTask;
-        BaseType_t xReturn;
+        TCB_t * pxTCB;
+        BaseType_t xReturn = pdPASS;
+        BaseType_t xYieldRequired = pdFALSE;
 
-        configASSERT( pxTCB );
+        configASSERT( ( xBudget > ( TickType_t ) 0U ) && ( xBudget <= xPeriod ) );
 
         vTaskSuspendAll();
         {
-            /* A task can only be prematurely removed from the Blocked state if
-             * it is actually in the Blocked state. */
-            if( eTaskGetState( xTask ) == eBlocked )
-            {
-                xReturn = pdPASS;
-
-                /* Remove the reference to the task from the blocked list.  An
-                 * interrupt won't touch the xStateListItem because the
-                 * scheduler is suspended. */
-                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+            /* If null is passed in here then the calling task becomes the
+             * server's task. */
+            pxTCB = prvGetTCBFromHandle( xTask );
 
-                /* Is the task waiting on an event also?  If so remove it from
-                 * the event list too.  Interrupts can touch the event list item,
-                 * even though the scheduler is suspended, so a critical section
-                 * is used. */
-                taskENTER_CRITICAL();
-                {
-                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+            /* Moving the deadline of a job on the shared stack could let it
+             * run again before the jobs above it have completed. */
+            if( taskEDF_STACK_IS_SHARED( pxTCB ) != pdFALSE )
+            {
+                xReturn = pdFAIL;
+            }
+            else
+            {
+                #if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
                     {
-                        ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+                        EDFTaskParameters_t xPrevious;
 
-                        /* This lets the task know it was forcibly removed from the
-                         * blocked state so it should not re-evaluate its block time and
-                         * then block again. */
-                        pxTCB->ucDelayAborted = pdTRUE;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-                }
-                taskEXIT_CRITICAL();
+                        xPrevious.xPeriod = pxTCB->xTaskPeriod;
+                        xPrevious.xRelativeDeadline = pxTCB->xRelativeDeadline;
+                        xPrevious.xWCET = pxTCB->xWCET;
 
-                /* Place the unblocked task into the appropriate ready list. */
-                prvAddTaskToReadyList( pxTCB );
+                        /* The server takes the place of whatever the task was
+                         * admitted with, which is kept if the server is refused. */
+                        if( xPrevious.xWCET != ( TickType_t ) 0U )
+                        {
+                            prvEDFAdmissionRemove( xPrevious.xPeriod, xPrevious.xRelativeDeadline, xPrevious.xWCET );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
 
-                /* A task being unblocked cannot cause an immediate context
-                 * switch if preemption is turned off. */
-                #if ( configUSE_PREEMPTION == 1 )
-                    {
-                        /* Preemption is on, but a context switch should only be
-                         * performed if the unblocked task has a priority that is
-                         * higher than the currently executing task. */
-                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                        xReturn = prvEDFAdmissionTest( xPeriod, xPeriod, xBudget, NULL );
+
+                        if( xReturn == pdPASS )
                         {
-                            /* Pend the yield to be performed when the scheduler
-                             * is unsuspended. */
-                            xYieldPending = pdTRUE;
+                            uxEDFAdmittedTaskCount++;
+                        }
+                        else if( xPrevious.xWCET != ( TickType_t ) 0U )
+                        {
+                            xEDFAdmittedTasks[ uxEDFAdmittedTaskCount ] = xPrevious;
+                            uxEDFAdmittedTaskCount++;
                         }
                         else
                         {
                             mtCOVERAGE_TEST_MARKER();
                         }
                     }
-                #endif /* configUSE_PREEMPTION */
+                #endif /* configUSE_EDF_ADMISSION_CONTROL */
+            }
+
+            if( xReturn == pdPASS )
+            {
+                xYieldRequired = prvEDFCBSStart( pxTCB, xBudget, xPeriod );
             }
             else
             {
-                xReturn = pdFAIL;
+                mtCOVERAGE_TEST_MARKER();
             }
         }
         ( void ) xTaskResumeAll();
 
+        if( xYieldRequired != pdFALSE )
+        {
+            taskYIELD_IF_USING_PREEMPTION();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
         return xReturn;
     }
 
-#endif /* INCLUDE_xTaskAbortDelay */
-/*----------------------------------------------------------*/
-
-BaseType_t xTaskIncrementTick( void )
-{
-    TCB_t * pxTCB;
-    TickType_t xItemValue;
-    BaseType_t xSwitchRequired = pdFALSE;
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_CBS == 1 ) */
+/*-----------------------------------------------------------*/
 
-    /* Called by the portable layer each time a tick interrupt occurs.
-     * Increments the tick then checks to see if the new tick value will cause any
-     * tasks to be unblocked. */
-    traceTASK_INCREMENT_TICK( xTickCount );
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
-    if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+    SRPResourceHandle_t xTaskSRPResourceCreate( void )
     {
-        /* Minor optimisation.  The tick count cannot change in this
-         * block. */
-        const TickType_t xConstTickCount = xTickCount + ( TickType_t ) 1;
+        EDFSRPResource_t * pxResource;
 
-        /* Increment the RTOS tick, switching the delayed and overflowed
-         * delayed lists if it wraps to 0. */
-        xTickCount = xConstTickCount;
+        pxResource = ( EDFSRPResource_t * ) pvPortMalloc( sizeof( EDFSRPResource_t ) );
 
-        if( xConstTickCount == ( TickType_t ) 0U ) /*lint !e774 'if' does not always evaluate to false as it is looking for an overflow. */
+        if( pxResource != NULL )
         {
-            taskSWITCH_DELAYED_LISTS();
+            /* The ceiling is set as users are declared. */
+            pxResource->xCeiling = portMAX_DELAY;
+            pxResource->xPreviousCeiling = portMAX_DELAY;
+            pxResource->pxHolder = NULL;
+            pxResource->pxPreviousLocked = NULL;
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
 
-        /* See if this tick has made a timeout expire.  Tasks are stored in
-         * the  queue in the order of their wake time - meaning once one task
-         * has been found whose block time has not expired there is no need to
-         * look any further down the list. */
-        if( xConstTickCount >= xNextTaskUnblockTime )
+        return pxResource;
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) )
+
+    void vTaskSRPResourceUsedBy( SRPResourceHandle_t xResource,
+                                 TaskHandle_t xTask )
+    {
+        TCB_t const * pxTCB;
+
+        configASSERT( xResource );
+
+        taskENTER_CRITICAL();
         {
-            for( ; ; )
-            {
-                if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
-                {
-                    /* The delayed list is empty.  Set xNextTaskUnblockTime
-                     * to the maximum possible value so it is extremely
-                     * unlikely that the
-                     * if( xTickCount >= xNextTaskUnblockTime ) test will pass
-                     * next time through. */
-                    xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-                    break;
-                }
-                else
-                {
-                    /* The delayed list is not empty, get the value of the
-                     * item at the head of the delayed list.  This is the time
-                     * at which the task at the head of the delayed list must
-                     * be removed from the Blocked state. */
-                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-                    xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+            /* If null is passed in here then the calling task is declared as
+             * a user. */
+            pxTCB = prvGetTCBFromHandle( xTask );
 
-                    if( xConstTickCount < xItemValue )
-                    {
-                        /* It is not time to unblock this item yet, but the
-                         * item value is the time at which the task at the head
-                         * of the blocked list must be removed from the Blocked
+            /* The system ceiling was worked out from the ceiling the resource
+             * had when it was locked, so it must not change under a holder. */
+            configASSERT( xResource->pxHolder == NULL );
+
+            if( pxTCB->xRelativeDeadline < xResource->xCeiling )
+            {
+                xResource->xCeiling = pxTCB->xRelativeDeadline;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskSRPLock( SRPResourceHandle_t xResource )
+    {
+        configASSERT( xResource );
+
+        taskENTER_CRITICAL();
+        {
+            /* Every task that uses the resource has a relative deadline at
+             * least as long as its ceiling, so is held back while the resource
+             * is locked.  The resource is therefore always free here, and the
+             * caller must have been declared as one of its users. */
+            configASSERT( xResource->pxHolder == NULL );
+            configASSERT( pxCurrentTCB->xRelativeDeadline >= xResource->xCeiling );
+
+            xResource->pxHolder = pxCurrentTCB;
+            xResource->xPreviousCeiling = xEDFSystemCeiling;
+            xResource->pxPreviousLocked = pxEDFLockedResources;
+            pxEDFLockedResources = xResource;
+            pxCurrentTCB->uxSRPResourcesHeld++;
+
+            if( xResource->xCeiling < xEDFSystemCeiling )
+            {
+                xEDFSystemCeiling = xResource->xCeiling;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskSRPUnlock( SRPResourceHandle_t xResource )
+    {
+        BaseType_t xYieldRequired;
+        BaseType_t xThrottled = pdFALSE;
+
+        configASSERT( xResource );
+
+        taskENTER_CRITICAL();
+        {
+            /* Only the holder can unlock the resource, and only the resource
+             * it locked last. */
+            configASSERT( xResource->pxHolder == pxCurrentTCB );
+            configASSERT( pxEDFLockedResources == xResource );
+
+            pxEDFLockedResources = xResource->pxPreviousLocked;
+            xEDFSystemCeiling = xResource->xPreviousCeiling;
+            xResource->pxHolder = NULL;
+            xResource->pxPreviousLocked = NULL;
+            pxCurrentTCB->uxSRPResourcesHeld--;
+
+            /* prvEDFBudgetExhausted() put off an overrun of the task while it
+             * held a resource.  With the last one unlocked it can be acted on,
+             * before the tasks it held back are let in. */
+            #if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+                {
+                    if( ( pxCurrentTCB->uxSRPResourcesHeld == ( UBaseType_t ) 0U ) &&
+                        ( pxCurrentTCB->xBudgetExhausted != pdFALSE ) )
+                    {
+                        ( void ) prvEDFBudgetExhausted();
+
+                        #if ( configUSE_EDF_EVENT_TICK == 1 )
+                            {
+                                /* The budget of the new job may run out first. */
+                                prvEDFSetNextEvent();
+                            }
+                        #endif
+
+                        /* A throttled task is no longer Ready, so must give
+                         * way even without preemption. */
+                        if( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( pxCurrentTCB->xStateListItem ) ) == pdFALSE )
+                        {
+                            xThrottled = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif
+
+            xYieldRequired = prvEDFSRPReleaseHeldBack();
+        }
+        taskEXIT_CRITICAL();
+
+        if( xThrottled != pdFALSE )
+        {
+            portYIELD_WITHIN_API();
+        }
+        else if( xYieldRequired != pdFALSE )
+        {
+            taskYIELD_IF_USING_PREEMPTION();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxTaskGetNumberOfTasks( void )
+{
+    /* A critical section is not required because the variables are of type
+     * BaseType_t. */
+    return uxCurrentNumberOfTasks;
+}
+/*-----------------------------------------------------------*/
+
+char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+    TCB_t * pxTCB;
+
+    /* If null is passed in here then the name of the calling task is being
+     * queried. */
+    pxTCB = prvGetTCBFromHandle( xTaskToQuery );
+    configASSERT( pxTCB );
+    return &( pxTCB->pcTaskName[ 0 ] );
+}
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskGetHandle == 1 )
+
+    static TCB_t * prvSearchForNameWithinSingleList( List_t * pxList,
+                                                     const char pcNameToQuery[] )
+    {
+        TCB_t * pxNextTCB, * pxFirstTCB, * pxReturn = NULL;
+        UBaseType_t x;
+        char cNextChar;
+        BaseType_t xBreakLoop;
+
+        /* This function is called with the scheduler suspended. */
+
+        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+        {
+            listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+            do
+            {
+                listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+                /* Check each character in the name looking for a match or
+                 * mismatch. */
+                xBreakLoop = pdFALSE;
+
+                for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+                {
+                    cNextChar = pxNextTCB->pcTaskName[ x ];
+
+                    if( cNextChar != pcNameToQuery[ x ] )
+                    {
+                        /* Characters didn't match. */
+                        xBreakLoop = pdTRUE;
+                    }
+                    else if( cNextChar == ( char ) 0x00 )
+                    {
+                        /* Both strings terminated, a match must have been
+                         * found. */
+                        pxReturn = pxNextTCB;
+                        xBreakLoop = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    if( xBreakLoop != pdFALSE )
+                    {
+                        break;
+                    }
+                }
+
+                if( pxReturn != NULL )
+                {
+                    /* The handle has been found. */
+                    break;
+                }
+            } while( pxNextTCB != pxFirstTCB );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxReturn;
+    }
+
+#endif /* INCLUDE_xTaskGetHandle */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskGetHandle == 1 )
+
+    TaskHandle_t xTaskGetHandle( const char * pcNameToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+    {
+        UBaseType_t uxQueue = configMAX_PRIORITIES;
+        TCB_t * pxTCB;
+
+        /* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
+        configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
+
+        vTaskSuspendAll();
+        {
+            /* Search the ready lists. */
+            do
+            {
+                uxQueue--;
+                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
+
+                if( pxTCB != NULL )
+                {
+                    /* Found the handle. */
+                    break;
+                }
+            } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+            /* Search the delayed lists. */
+            if( pxTCB == NULL )
+            {
+                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+            }
+
+            if( pxTCB == NULL )
+            {
+                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+            }
+
+            #if ( configUSE_TIMING_WHEEL == 1 )
+                {
+                    for( uxQueue = ( UBaseType_t ) 0U; ( uxQueue < ( UBaseType_t ) ( 2 * configTIMING_WHEEL_SLOTS ) ) && ( pxTCB == NULL ); uxQueue++ )
+                    {
+                        pxTCB = prvSearchForNameWithinSingleList( &( xTimingWheel[ 0 ][ 0 ] ) + uxQueue, pcNameToQuery );
+                    }
+                }
+            #endif
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+                {
+                    if( pxTCB == NULL )
+                    {
+                        /* Search the suspended list. */
+                        pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
+                    }
+                }
+            #endif
+
+            #if ( INCLUDE_vTaskDelete == 1 )
+                {
+                    if( pxTCB == NULL )
+                    {
+                        /* Search the deleted list. */
+                        pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
+                    }
+                }
+            #endif
+        }
+        ( void ) xTaskResumeAll();
+
+        return pxTCB;
+    }
+
+#endif /* INCLUDE_xTaskGetHandle */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
+                                      const UBaseType_t uxArraySize,
+                                      configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
+    {
+        UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+
+        vTaskSuspendAll();
+        {
+            /* Is there a space in the array for each task in the system? */
+            if( uxArraySize >= uxCurrentNumberOfTasks )
+            {
+                /* Fill in an TaskStatus_t structure with information on each
+                 * task in the Ready state. */
+                do
+                {
+                    uxQueue--;
+                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
+                } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+                /* Fill in an TaskStatus_t structure with information on each
+                 * task in the Blocked state. */
+                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+
+                #if ( configUSE_TIMING_WHEEL == 1 )
+                    {
+                        for( uxQueue = ( UBaseType_t ) 0U; uxQueue < ( UBaseType_t ) ( 2 * configTIMING_WHEEL_SLOTS ); uxQueue++ )
+                        {
+                            uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xTimingWheel[ 0 ][ 0 ] ) + uxQueue, eBlocked );
+                        }
+                    }
+                #endif
+
+                #if ( INCLUDE_vTaskDelete == 1 )
+                    {
+                        /* Fill in an TaskStatus_t structure with information on
+                         * each task that has been deleted but not yet cleaned up. */
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, eDeleted );
+                    }
+                #endif
+
+                #if ( INCLUDE_vTaskSuspend == 1 )
+                    {
+                        /* Fill in an TaskStatus_t structure with information on
+                         * each task in the Suspended state. */
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xSuspendedTaskList, eSuspended );
+                    }
+                #endif
+
+                #if ( configGENERATE_RUN_TIME_STATS == 1 )
+                    {
+                        if( pulTotalRunTime != NULL )
+                        {
+                            #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                                portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
+                            #else
+                                *pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+                            #endif
+                        }
+                    }
+                #else /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+                    {
+                        if( pulTotalRunTime != NULL )
+                        {
+                            *pulTotalRunTime = 0;
+                        }
+                    }
+                #endif /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return uxTask;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+
+    TaskHandle_t xTaskGetIdleTaskHandle( void )
+    {
+        /* If xTaskGetIdleTaskHandle() is called before the scheduler has been
+         * started, then xIdleTaskHandle will be NULL. */
+        configASSERT( ( xIdleTaskHandle != NULL ) );
+        return xIdleTaskHandle;
+    }
+
+#endif /* INCLUDE_xTaskGetIdleTaskHandle */
+/*----------------------------------------------------------*/
+
+/* This conditional compilation should use inequality to 0, not equality to 1.
+ * This is to ensure vTaskStepTick() is available when user defined low power mode
+ * implementations require configUSE_TICKLESS_IDLE to be set to a value other than
+ * 1. */
+#if ( configUSE_TICKLESS_IDLE != 0 )
+
+    void vTaskStepTick( const TickType_t xTicksToJump )
+    {
+        TickType_t xUpdatedTickCount = xTickCount + xTicksToJump;
+
+        /* Correct the tick count value after a period during which the tick
+         * was suppressed.  Note this does *not* call the tick hook function for
+         * each stepped tick. */
+        configASSERT( xUpdatedTickCount <= xNextTaskUnblockTime );
+
+        if( xUpdatedTickCount == xNextTaskUnblockTime )
+        {
+            /* Arrange for xTickCount to reach xNextTaskUnblockTime in
+             * xTaskIncrementTick() when the scheduler resumes.  This ensures
+             * the tasks due then, such as the jobs released then under EDF, are
+             * all unblocked at the correct time, in one pass of the delayed
+             * list, rather than a tick late. */
+            configASSERT( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE );
+            configASSERT( xTicksToJump != ( TickType_t ) 0 );
+
+            /* Prevent the tick interrupt modifying xPendedTicks simultaneously. */
+            taskENTER_CRITICAL();
+            {
+                xPendedTicks++;
+            }
+            taskEXIT_CRITICAL();
+            xUpdatedTickCount--;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xTickCount = xUpdatedTickCount;
+
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FINE_TIME == 1 ) )
+            {
+                ulEDFCounterAtTick = ( uint32_t ) portEDF_GET_BUDGET_COUNTER();
+            }
+        #endif
+
+        traceINCREASE_TICK_COUNT( xTicksToJump );
+    }
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*----------------------------------------------------------*/
+
+BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
+{
+    BaseType_t xYieldOccurred;
+
+    /* Must not be called with the scheduler suspended as the implementation
+     * relies on xPendedTicks being wound down to 0 in xTaskResumeAll(). */
+    configASSERT( uxSchedulerSuspended == 0 );
+
+    /* Use xPendedTicks to mimic xTicksToCatchUp number of ticks occurring when
+     * the scheduler is suspended so the ticks are executed in xTaskResumeAll(). */
+    vTaskSuspendAll();
+    xPendedTicks += xTicksToCatchUp;
+    xYieldOccurred = xTaskResumeAll();
+
+    return xYieldOccurred;
+}
+/*----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskAbortDelay == 1 )
+
+    BaseType_t xTaskAbortDelay( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB = xTask;
+        BaseType_t xReturn;
+
+        configASSERT( pxTCB );
+
+        vTaskSuspendAll();
+        {
+            /* A task can only be prematurely removed from the Blocked state if
+             * it is actually in the Blocked state. */
+            if( eTaskGetState( xTask ) == eBlocked )
+            {
+                xReturn = pdPASS;
+
+                /* Remove the reference to the task from the blocked list.  An
+                 * interrupt won't touch the xStateListItem because the
+                 * scheduler is suspended. */
+                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+                /* Is the task waiting on an event also?  If so remove it from
+                 * the event list too.  Interrupts can touch the event list item,
+                 * even though the scheduler is suspended, so a critical section
+                 * is used. */
+                taskENTER_CRITICAL();
+                {
+                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                    {
+                        ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+
+                        /* This lets the task know it was forcibly removed from the
+                         * blocked state so it should not re-evaluate its block time and
+                         * then block again. */
+                        pxTCB->ucDelayAborted = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+
+                /* Place the unblocked task into the appropriate ready list. */
+                prvAddTaskToReadyList( pxTCB );
+
+                /* A task being unblocked cannot cause an immediate context
+                 * switch if preemption is turned off. */
+                #if ( configUSE_PREEMPTION == 1 )
+                    {
+                        /* Preemption is on, but a context switch should only be
+                         * performed if the unblocked task has a priority that is
+                         * higher than the currently executing task. */
+                        if( taskWOKEN_TASK_PREEMPTS( pxTCB, ( pxTCB->uxPriority > pxCurrentTCB->uxPriority ) ) != pdFALSE )
+                        {
+                            /* Pend the yield to be performed when the scheduler
+                             * is unsuspended. */
+                            xYieldPending = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif /* configUSE_PREEMPTION */
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return xReturn;
+    }
+
+#endif /* INCLUDE_xTaskAbortDelay */
+/*----------------------------------------------------------*/
+
+BaseType_t xTaskIncrementTick( void )
+{
+    TCB_t * pxTCB;
+    TickType_t xItemValue;
+    BaseType_t xSwitchRequired = pdFALSE;
+
+    /* Called by the portable layer each time a tick interrupt occurs.
+     * Increments the tick then checks to see if the new tick value will cause any
+     * tasks to be unblocked. */
+    traceTASK_INCREMENT_TICK( xTickCount );
+
+    if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+    {
+        /* Minor optimisation.  The tick count cannot change in this
+         * block. */
+        const TickType_t xConstTickCount = xTickCount + ( TickType_t ) 1;
+
+        /* Increment the RTOS tick, switching the delayed and overflowed
+         * delayed lists if it wraps to 0. */
+        xTickCount = xConstTickCount;
+
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FINE_TIME == 1 ) && ( configUSE_EDF_EVENT_TICK == 0 ) )
+            {
+                ulEDFCounterAtTick = ( uint32_t ) portEDF_GET_BUDGET_COUNTER();
+            }
+        #endif
+
+        if( xConstTickCount == ( TickType_t ) 0U ) /*lint !e774 'if' does not always evaluate to false as it is looking for an overflow. */
+        {
+            taskSWITCH_DELAYED_LISTS();
+
+            #if ( configUSE_TIMING_WHEEL == 1 )
+                {
+                    /* prvResetNextTaskUnblockTime() only looks for wheel work
+                     * after the tick count, so would miss the tasks due on
+                     * tick 0, which could not be noted before the overflow. */
+                    xNextTaskUnblockTime = xConstTickCount;
+                }
+            #endif
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BUCKET_READY_QUEUE == 1 ) )
+            {
+                /* Keep the EDF bucket window starting at the tick count so the
+                 * tasks released below fall inside it. */
+                prvEDFBucketAdvance( xConstTickCount );
+            }
+        #endif
+
+        #if ( configUSE_EDF_ISR_RELEASE_QUEUE == 1 )
+            {
+                /* The deadlines of the tasks woken since the last tick or
+                 * context switch are checked below with the others. */
+                prvEDFReadyPendingReleases();
+            }
+        #endif
+
+        /* See if this tick has made a timeout expire.  Tasks are stored in
+         * the  queue in the order of their wake time - meaning once one task
+         * has been found whose block time has not expired there is no need to
+         * look any further down the list. */
+        if( xConstTickCount >= xNextTaskUnblockTime )
+        {
+            #if ( configUSE_TIMING_WHEEL == 1 )
+                {
+                    if( prvTimingWheelTick( xConstTickCount ) != pdFALSE )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif
+
+            for( ; ; )
+            {
+                if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+                {
+                    /* The delayed list is empty.  Set xNextTaskUnblockTime
+                     * to the maximum possible value so it is extremely
+                     * unlikely that the
+                     * if( xTickCount >= xNextTaskUnblockTime ) test will pass
+                     * next time through. */
+                    xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                    break;
+                }
+                else
+                {
+                    /* The delayed list is not empty, get the value of the
+                     * item at the head of the delayed list.  This is the time
+                     * at which the task at the head of the delayed list must
+                     * be removed from the Blocked state. */
+                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                    xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+
+                    if( xConstTickCount < xItemValue )
+                    {
+                        /* It is not time to unblock this item yet, but the
+                         * item value is the time at which the task at the head
+                         * of the blocked list must be removed from the Blocked
                          * state -  so record the item value in
                          * xNextTaskUnblockTime. */
                         xNextTaskUnblockTime = xItemValue;
@@ -2950,99 +5203,2135 @@ BaseType_t xTaskIncrementTick( void )
                         mtCOVERAGE_TEST_MARKER();
                     }
 
-                    /* It is time to remove the item from the Blocked state. */
-                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                    if( prvUnblockTaskAtWakeTime( pxTCB ) != pdFALSE )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+
+            #if ( configUSE_TIMING_WHEEL == 1 )
+                {
+                    prvTimingWheelLimitUnblockTime();
+                }
+            #endif
+
+            #if ( configUSE_EDF_SCHEDULER == 1 )
+                {
+                    if( prvEDFReadyReleasedTasks( pdTRUE ) != pdFALSE )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif
+        }
+
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DEADLINE_MISS_DETECTION == 1 ) )
+            {
+                /* The running task, or a Ready task with an earlier deadline,
+                 * is the first to miss its deadline.  These are normally the
+                 * same task. */
+                taskEDF_CHECK_DEADLINE( pxCurrentTCB, taskEDF_TIME_FROM_TICKS( xConstTickCount ) );
+
+                pxTCB = taskEDF_GET_EARLIEST_DEADLINE_TASK();
+
+                if( ( pxTCB != pxCurrentTCB ) && ( pxTCB != NULL ) )
+                {
+                    taskEDF_CHECK_DEADLINE( pxTCB, taskEDF_TIME_FROM_TICKS( xConstTickCount ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 ) )
+            {
+                taskEDF_CHARGE_BUDGET( pdTRUE );
+
+                /* Only a job that is still Ready can overrun.  The running task
+                 * may already have blocked if the tick was held pending while
+                 * the scheduler was suspended. */
+                if( ( pxCurrentTCB->xWCET != ( TickType_t ) 0U ) &&
+                    ( taskEDF_BUDGET_EXHAUSTED( pxCurrentTCB ) != pdFALSE ) &&
+                    ( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( pxCurrentTCB->xStateListItem ) ) != pdFALSE ) )
+                {
+                    if( prvEDFBudgetExhausted() != pdFALSE )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        /* Tasks of equal priority to the currently running task will share
+         * processing time (time slice) if preemption is on, and the application
+         * writer has not explicitly turned time slicing off.  Under EDF the
+         * priority lists are not used, and configEDF_TIE_BREAK decides whether
+         * tasks with the deadline of the running task share it instead. */
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                #if ( ( configUSE_PREEMPTION == 1 ) && ( configEDF_TIE_BREAK == tskEDF_TIE_ROUND_ROBIN ) )
+                    {
+                        /* Requeuing the running task puts it behind the tasks
+                         * with the same deadline, so it only loses the
+                         * processor to one of them.  A job on the shared stack
+                         * must finish before the one below it resumes, and
+                         * one holding an SRP resource keeps it. */
+                        if( ( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( pxCurrentTCB->xStateListItem ) ) != pdFALSE ) &&
+                            ( taskEDF_STACK_IS_SHARED( pxCurrentTCB ) == pdFALSE ) &&
+                            ( taskEDF_TIE_CAN_ROTATE( pxCurrentTCB ) != pdFALSE ) &&
+                            ( taskEDF_DEADLINE( taskEDF_GET_EARLIEST_DEADLINE_TASK() ) == taskEDF_DEADLINE( pxCurrentTCB ) ) )
+                        {
+                            if( prvEDFRequeueCurrentTask() != pdFALSE )
+                            {
+                                uxEDFTieSwitches++;
+                                xSwitchRequired = pdTRUE;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configEDF_TIE_BREAK == tskEDF_TIE_ROUND_ROBIN ) ) */
+            }
+        #elif ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+            {
+                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_EDF_SCHEDULER */
+
+        #if ( configUSE_TICK_HOOK == 1 )
+            {
+                /* Guard against the tick hook being called when the pended tick
+                 * count is being unwound (when the scheduler is being unlocked). */
+                if( xPendedTicks == ( TickType_t ) 0 )
+                {
+                    vApplicationTickHook();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_TICK_HOOK */
+
+        #if ( configUSE_PREEMPTION == 1 )
+            {
+                if( xYieldPending != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_PREEMPTION */
+    }
+    else
+    {
+        ++xPendedTicks;
+
+        /* The tick hook gets called at regular intervals, even if the
+         * scheduler is locked. */
+        #if ( configUSE_TICK_HOOK == 1 )
+            {
+                vApplicationTickHook();
+            }
+        #endif
+    }
+
+    return xSwitchRequired;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_EVENT_TICK == 1 )
+
+    BaseType_t xTaskEDFEventTick( void )
+    {
+        BaseType_t xSwitchRequired;
+
+        /* Called by the portable layer from the compare interrupt set by
+         * portEDF_SET_COMPARE(), in place of xTaskIncrementTick(). */
+        xSwitchRequired = prvEDFCountTicks();
+        prvEDFSetNextEvent();
+
+        return xSwitchRequired;
+    }
+
+#endif /* configUSE_EDF_EVENT_TICK */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+    void vTaskSetApplicationTaskTag( TaskHandle_t xTask,
+                                     TaskHookFunction_t pxHookFunction )
+    {
+        TCB_t * xTCB;
+
+        /* If xTask is NULL then it is the task hook of the calling task that is
+         * getting set. */
+        if( xTask == NULL )
+        {
+            xTCB = ( TCB_t * ) pxCurrentTCB;
+        }
+        else
+        {
+            xTCB = xTask;
+        }
+
+        /* Save the hook function in the TCB.  A critical section is required as
+         * the value can be accessed from an interrupt. */
+        taskENTER_CRITICAL();
+        {
+            xTCB->pxTaskTag = pxHookFunction;
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+    TaskHookFunction_t xTaskGetApplicationTaskTag( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        TaskHookFunction_t xReturn;
+
+        /* If xTask is NULL then set the calling task's hook. */
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        /* Save the hook function in the TCB.  A critical section is required as
+         * the value can be accessed from an interrupt. */
+        taskENTER_CRITICAL();
+        {
+            xReturn = pxTCB->pxTaskTag;
+        }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
+    }
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+    TaskHookFunction_t xTaskGetApplicationTaskTagFromISR( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        TaskHookFunction_t xReturn;
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* If xTask is NULL then set the calling task's hook. */
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        /* Save the hook function in the TCB.  A critical section is required as
+         * the value can be accessed from an interrupt. */
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            xReturn = pxTCB->pxTaskTag;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+    BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask,
+                                             void * pvParameter )
+    {
+        TCB_t * xTCB;
+        BaseType_t xReturn;
+
+        /* If xTask is NULL then we are calling our own task hook. */
+        if( xTask == NULL )
+        {
+            xTCB = pxCurrentTCB;
+        }
+        else
+        {
+            xTCB = xTask;
+        }
+
+        if( xTCB->pxTaskTag != NULL )
+        {
+            xReturn = xTCB->pxTaskTag( pvParameter );
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+void vTaskSwitchContext( void )
+{
+    if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
+    {
+        /* The scheduler is currently suspended - do not allow a context
+         * switch. */
+        xYieldPending = pdTRUE;
+    }
+    else
+    {
+        xYieldPending = pdFALSE;
+        traceTASK_SWITCHED_OUT();
+
+        #if ( configGENERATE_RUN_TIME_STATS == 1 )
+            {
+                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                    portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime );
+                #else
+                    ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+                #endif
+
+                /* Add the amount of time the task has been running to the
+                 * accumulated time so far.  The time the task started running was
+                 * stored in ulTaskSwitchedInTime.  Note that there is no overflow
+                 * protection here so count values are only valid until the timer
+                 * overflows.  The guard against negative values is to protect
+                 * against suspect run time stat counter implementations - which
+                 * are provided by the application, not the kernel. */
+                if( ulTotalRunTime > ulTaskSwitchedInTime )
+                {
+                    pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                ulTaskSwitchedInTime = ulTotalRunTime;
+            }
+        #endif /* configGENERATE_RUN_TIME_STATS */
+
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 ) )
+            {
+                /* Charge the task being switched out for the time it ran. */
+                taskEDF_CHARGE_BUDGET( pdFALSE );
+            }
+        #endif
+
+        /* Check for stack overflow, if configured. */
+        taskCHECK_FOR_STACK_OVERFLOW();
+
+        /* Before the currently running task is switched out, save its errno. */
+        #if ( configUSE_POSIX_ERRNO == 1 )
+            {
+                pxCurrentTCB->iTaskErrno = FreeRTOS_errno;
+            }
+        #endif
+
+        /* Select a new task to run using either the generic C or port
+         * optimised asm code. */
+         
+				/* E.C. : */
+			  #if (configUSE_EDF_SCHEDULER == 0)
+			  {
+			  taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			  }
+			  #else
+			  {
+			  TCB_t * const pxPreviousTCB = pxCurrentTCB;
+
+			  #if ( configUSE_EDF_ISR_RELEASE_QUEUE == 1 )
+			  {
+			      prvEDFReadyPendingReleases();
+			  }
+			  #endif
+
+			  taskSELECT_EARLIEST_DEADLINE_TASK();
+
+			  if( pxCurrentTCB != pxPreviousTCB )
+			  {
+			      uxEDFContextSwitches++;
+
+			      #if ( configUSE_EDF_JOB_RECORDS == 1 )
+			      {
+			          /* A task switched out while it is still in the ready
+			           * queue has been preempted. */
+			          if( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( pxPreviousTCB->xStateListItem ) ) != pdFALSE )
+			          {
+			              pxPreviousTCB->uxJobPreemptions++;
+			          }
+			          else
+			          {
+			              mtCOVERAGE_TEST_MARKER();
+			          }
+
+			          taskEDF_JOB_DISPATCHED();
+			      }
+			      #endif
+			  }
+			  else
+			  {
+			      mtCOVERAGE_TEST_MARKER();
+			  }
+
+			  #if ( configUSE_EDF_SHARED_STACK == 1 )
+			  {
+			      prvEDFSharedStackDispatch();
+			  }
+			  #endif
+
+			  #if ( configUSE_EDF_EVENT_TICK == 1 )
+			  {
+			      /* The deadline and budget of the new task may come first. */
+			      prvEDFSetNextEvent();
+			  }
+			  #endif
+			  }
+			  #endif
+							
+        traceTASK_SWITCHED_IN();
+
+        /* After the new task is switched in, update the global errno. */
+        #if ( configUSE_POSIX_ERRNO == 1 )
+            {
+                FreeRTOS_errno = pxCurrentTCB->iTaskErrno;
+            }
+        #endif
+
+        #if ( configUSE_NEWLIB_REENTRANT == 1 )
+            {
+                /* Switch Newlib's _impure_ptr variable to point to the _reent
+                 * structure specific to this task.
+                 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
+                 * for additional information. */
+                _impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+            }
+        #endif /* configUSE_NEWLIB_REENTRANT */
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vTaskPlaceOnEventList( List_t * const pxEventList,
+                            const TickType_t xTicksToWait )
+{
+    configASSERT( pxEventList );
+
+    /* THIS FUNCTION MUST BE CALLED WITH EITHER INTERRUPTS DISABLED OR THE
+     * SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED. */
+
+    /* Place the event list item of the TCB in the appropriate event list.
+     * This is placed in the list in priority order so the highest priority task
+     * is the first to be woken by the event.
+     *
+     * Note: Lists are sorted in ascending order by ListItem_t.xItemValue.
+     * Normally, the xItemValue of a TCB's ListItem_t members is:
+     *      xItemValue = ( configMAX_PRIORITIES - uxPriority )
+     * Therefore, the event list is sorted in descending priority order.
+     *
+     * Under EDF the priority does not order the tasks, so the list is sorted
+     * on the deadline instead and the task with the earliest deadline is the
+     * first to be woken.
+     *
+     * The queue that contains the event list is locked, preventing
+     * simultaneous access from interrupts. */
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        {
+            listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), taskEDF_DEADLINE( pxCurrentTCB ) );
+            pxCurrentTCB->xEventListItemOnDeadline = pdTRUE;
+            prvEDFListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+        }
+    #else
+        {
+            vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+        }
+    #endif
+
+    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+}
+/*-----------------------------------------------------------*/
+
+void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
+                                     const TickType_t xItemValue,
+                                     const TickType_t xTicksToWait )
+{
+    configASSERT( pxEventList );
+
+    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
+     * the event groups implementation. */
+    configASSERT( uxSchedulerSuspended != 0 );
+
+    /* Store the item value in the event list item.  It is safe to access the
+     * event list item here as interrupts won't access the event list item of a
+     * task that is not in the Blocked state. */
+    listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        {
+            pxCurrentTCB->xEventListItemOnDeadline = pdFALSE;
+        }
+    #endif
+
+    /* Place the event list item of the TCB at the end of the appropriate event
+     * list.  It is safe to access the event list here because it is part of an
+     * event group implementation - and interrupts don't access event groups
+     * directly (instead they access them indirectly by pending function calls to
+     * the task level). */
+    listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMERS == 1 )
+
+    void vTaskPlaceOnEventListRestricted( List_t * const pxEventList,
+                                          TickType_t xTicksToWait,
+                                          const BaseType_t xWaitIndefinitely )
+    {
+        configASSERT( pxEventList );
+
+        /* This function should not be called by application code hence the
+         * 'Restricted' in its name.  It is not part of the public API.  It is
+         * designed for use by kernel code, and has special calling requirements -
+         * it should be called with the scheduler suspended. */
+
+
+        /* Place the event list item of the TCB in the appropriate event list.
+         * In this case it is assume that this is the only task that is going to
+         * be waiting on this event list, so the faster vListInsertEnd() function
+         * can be used in place of vListInsert. */
+        listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                pxCurrentTCB->xEventListItemOnDeadline = pdFALSE;
+            }
+        #endif
+
+        /* If the task should block indefinitely then set the block time to a
+         * value that will be recognised as an indefinite delay inside the
+         * prvAddCurrentTaskToDelayedList() function. */
+        if( xWaitIndefinitely != pdFALSE )
+        {
+            xTicksToWait = portMAX_DELAY;
+        }
+
+        traceTASK_DELAY_UNTIL( ( xTickCount + xTicksToWait ) );
+        prvAddCurrentTaskToDelayedList( xTicksToWait, xWaitIndefinitely );
+    }
+
+#endif /* configUSE_TIMERS */
+/*-----------------------------------------------------------*/
+
+BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
+{
+    TCB_t * pxUnblockedTCB;
+    BaseType_t xReturn;
+
+    /* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
+     * called from a critical section within an ISR. */
+
+    /* The event list is sorted in priority order, so the first in the list can
+     * be removed as it is known to be the highest priority.  Remove the TCB from
+     * the delayed list, and add it to the ready list.
+     *
+     * If an event is for a queue that is locked then this function will never
+     * get called - the lock count on the queue will get modified instead.  This
+     * means exclusive access to the event list is guaranteed here.
+     *
+     * This function assumes that a check has already been made to ensure that
+     * pxEventList is not empty. */
+    pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+    configASSERT( pxUnblockedTCB );
+    listREMOVE_ITEM( &( pxUnblockedTCB->xEventListItem ) );
+
+    if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+    {
+        listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
+        prvAddWokenTaskToReadyList( pxUnblockedTCB );
+
+        #if ( configUSE_TICKLESS_IDLE != 0 )
+            {
+                /* If a task is blocked on a kernel object then xNextTaskUnblockTime
+                 * might be set to the blocked task's time out time.  If the task is
+                 * unblocked for a reason other than a timeout xNextTaskUnblockTime is
+                 * normally left unchanged, because it is automatically reset to a new
+                 * value when the tick count equals xNextTaskUnblockTime.  However if
+                 * tickless idling is used it might be more important to enter sleep mode
+                 * at the earliest possible time - so reset xNextTaskUnblockTime here to
+                 * ensure it is updated at the earliest possible time. */
+                prvResetNextTaskUnblockTime();
+            }
+        #endif
+    }
+    else
+    {
+        /* The delayed and ready lists cannot be accessed, so hold this task
+         * pending until the scheduler is resumed. */
+        listINSERT_END( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
+    }
+
+    if( taskWOKEN_TASK_PREEMPTS( pxUnblockedTCB, ( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority ) ) != pdFALSE )
+    {
+        /* Return true if the task removed from the event list has a higher
+         * priority than the calling task.  This allows the calling task to know if
+         * it should force a context switch now. */
+        xReturn = pdTRUE;
+
+        /* Mark that a yield is pending in case the user is not using the
+         * "xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS function. */
+        xYieldPending = pdTRUE;
+    }
+    else
+    {
+        xReturn = pdFALSE;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
+                                        const TickType_t xItemValue )
+{
+    TCB_t * pxUnblockedTCB;
+
+    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
+     * the event flags implementation. */
+    configASSERT( uxSchedulerSuspended != pdFALSE );
+
+    /* Store the new item value in the event list. */
+    listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+    /* Remove the event list form the event flag.  Interrupts do not access
+     * event flags. */
+    pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+    configASSERT( pxUnblockedTCB );
+    listREMOVE_ITEM( pxEventListItem );
+
+    #if ( configUSE_TICKLESS_IDLE != 0 )
+        {
+            /* If a task is blocked on a kernel object then xNextTaskUnblockTime
+             * might be set to the blocked task's time out time.  If the task is
+             * unblocked for a reason other than a timeout xNextTaskUnblockTime is
+             * normally left unchanged, because it is automatically reset to a new
+             * value when the tick count equals xNextTaskUnblockTime.  However if
+             * tickless idling is used it might be more important to enter sleep mode
+             * at the earliest possible time - so reset xNextTaskUnblockTime here to
+             * ensure it is updated at the earliest possible time. */
+            prvResetNextTaskUnblockTime();
+        }
+    #endif
+
+    /* Remove the task from the delayed list and add it to the ready list.  The
+     * scheduler is suspended so interrupts will not be accessing the ready
+     * lists. */
+    listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
+    prvAddTaskToReadyList( pxUnblockedTCB );
+
+    if( taskWOKEN_TASK_PREEMPTS( pxUnblockedTCB, ( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority ) ) != pdFALSE )
+    {
+        /* The unblocked task has a priority above that of the calling task, so
+         * a context switch is required.  This function is called with the
+         * scheduler suspended so xYieldPending is set so the context switch
+         * occurs immediately that the scheduler is resumed (unsuspended). */
+        xYieldPending = pdTRUE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
+{
+    configASSERT( pxTimeOut );
+    taskENTER_CRITICAL();
+    {
+        pxTimeOut->xOverflowCount = xNumOfOverflows;
+        pxTimeOut->xTimeOnEntering = taskTICK_COUNT_NOW();
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut )
+{
+    /* For internal use only as it does not use a critical section. */
+    pxTimeOut->xOverflowCount = xNumOfOverflows;
+    pxTimeOut->xTimeOnEntering = taskTICK_COUNT_NOW();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut,
+                                 TickType_t * const pxTicksToWait )
+{
+    BaseType_t xReturn;
+
+    configASSERT( pxTimeOut );
+    configASSERT( pxTicksToWait );
+
+    taskENTER_CRITICAL();
+    {
+        /* Minor optimisation.  The tick count cannot change in this block. */
+        const TickType_t xConstTickCount = taskTICK_COUNT_NOW();
+        const TickType_t xElapsedTime = xConstTickCount - pxTimeOut->xTimeOnEntering;
+
+        #if ( INCLUDE_xTaskAbortDelay == 1 )
+            if( pxCurrentTCB->ucDelayAborted != ( uint8_t ) pdFALSE )
+            {
+                /* The delay was aborted, which is not the same as a time out,
+                 * but has the same result. */
+                pxCurrentTCB->ucDelayAborted = pdFALSE;
+                xReturn = pdTRUE;
+            }
+            else
+        #endif
+
+        #if ( INCLUDE_vTaskSuspend == 1 )
+            if( *pxTicksToWait == portMAX_DELAY )
+            {
+                /* If INCLUDE_vTaskSuspend is set to 1 and the block time
+                 * specified is the maximum block time then the task should block
+                 * indefinitely, and therefore never time out. */
+                xReturn = pdFALSE;
+            }
+            else
+        #endif
+
+        if( ( xNumOfOverflows != pxTimeOut->xOverflowCount ) && ( xConstTickCount >= pxTimeOut->xTimeOnEntering ) ) /*lint !e525 Indentation preferred as is to make code within pre-processor directives clearer. */
+        {
+            /* The tick count is greater than the time at which
+             * vTaskSetTimeout() was called, but has also overflowed since
+             * vTaskSetTimeOut() was called.  It must have wrapped all the way
+             * around and gone past again. This passed since vTaskSetTimeout()
+             * was called. */
+            xReturn = pdTRUE;
+            *pxTicksToWait = ( TickType_t ) 0;
+        }
+        else if( xElapsedTime < *pxTicksToWait ) /*lint !e961 Explicit casting is only redundant with some compilers, whereas others require it to prevent integer conversion errors. */
+        {
+            /* Not a genuine timeout. Adjust parameters for time remaining. */
+            *pxTicksToWait -= xElapsedTime;
+            vTaskInternalSetTimeOutState( pxTimeOut );
+            xReturn = pdFALSE;
+        }
+        else
+        {
+            *pxTicksToWait = ( TickType_t ) 0;
+            xReturn = pdTRUE;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vTaskMissedYield( void )
+{
+    xYieldPending = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    UBaseType_t uxTaskGetTaskNumber( TaskHandle_t xTask )
+    {
+        UBaseType_t uxReturn;
+        TCB_t const * pxTCB;
+
+        if( xTask != NULL )
+        {
+            pxTCB = xTask;
+            uxReturn = pxTCB->uxTaskNumber;
+        }
+        else
+        {
+            uxReturn = 0U;
+        }
+
+        return uxReturn;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    void vTaskSetTaskNumber( TaskHandle_t xTask,
+                             const UBaseType_t uxHandle )
+    {
+        TCB_t * pxTCB;
+
+        if( xTask != NULL )
+        {
+            pxTCB = xTask;
+            pxTCB->uxTaskNumber = uxHandle;
+        }
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+
+/*
+ * -----------------------------------------------------------
+ * The Idle task.
+ * ----------------------------------------------------------
+ *
+ * The portTASK_FUNCTION() macro is used to allow port/compiler specific
+ * language extensions.  The equivalent prototype for this function is:
+ *
+ * void prvIdleTask( void *pvParameters );
+ *
+ */
+static portTASK_FUNCTION( prvIdleTask, pvParameters )
+{
+    /* Stop warnings. */
+    ( void ) pvParameters;
+
+    /** THIS IS THE RTOS IDLE TASK - WHICH IS CREATED AUTOMATICALLY WHEN THE
+     * SCHEDULER IS STARTED. **/
+
+    /* In case a task that has a secure context deletes itself, in which case
+     * the idle task is responsible for deleting the task's secure context, if
+     * any. */
+    portALLOCATE_SECURE_CONTEXT( configMINIMAL_SECURE_STACK_SIZE );
+
+    for( ; ; )
+    {
+        /* See if any tasks have deleted themselves - if so then the idle task
+         * is responsible for freeing the deleted task's TCB and stack. */
+        prvCheckTasksWaitingTermination();
+
+        #if ( configUSE_PREEMPTION == 0 )
+            {
+                /* If we are not using preemption we keep forcing a task switch to
+                 * see if any other task has become available.  If we are using
+                 * preemption we don't need to do this as any task becoming available
+                 * will automatically get the processor anyway. */
+                taskYIELD();
+            }
+        #endif /* configUSE_PREEMPTION */
+
+        /* Under EDF no task shares a ready list with the idle task, and any
+         * task that becomes Ready preempts it. */
+        #if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
+            {
+                /* When using preemption tasks of equal priority will be
+                 * timesliced.  If a task that is sharing the idle priority is ready
+                 * to run then the idle task should yield before the end of the
+                 * timeslice.
+                 *
+                 * A critical region is not required here as we are just reading from
+                 * the list, and an occasional incorrect value will not matter.  If
+                 * the ready list at the idle priority contains more than one task
+                 * then a task other than the idle task is ready to execute. */
+                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) 1 )
+                {
+                    taskYIELD();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) ) */
+
+        #if ( configUSE_IDLE_HOOK == 1 )
+            {
+                extern void vApplicationIdleHook( void );
+
+                /* Call the user defined function from within the idle task.  This
+                 * allows the application designer to add background functionality
+                 * without the overhead of a separate task.
+                 * NOTE: vApplicationIdleHook() MUST NOT, UNDER ANY CIRCUMSTANCES,
+                 * CALL A FUNCTION THAT MIGHT BLOCK. */
+                vApplicationIdleHook();
+            }
+        #endif /* configUSE_IDLE_HOOK */
+
+        /* This conditional compilation should use inequality to 0, not equality
+         * to 1.  This is to ensure portSUPPRESS_TICKS_AND_SLEEP() is called when
+         * user defined low power mode  implementations require
+         * configUSE_TICKLESS_IDLE to be set to a value other than 1. */
+        #if ( configUSE_TICKLESS_IDLE != 0 )
+            {
+                TickType_t xExpectedIdleTime;
+
+                /* It is not desirable to suspend then resume the scheduler on
+                 * each iteration of the idle task.  Therefore, a preliminary
+                 * test of the expected idle time is performed without the
+                 * scheduler suspended.  The result here is not necessarily
+                 * valid. */
+                xExpectedIdleTime = prvGetExpectedIdleTime();
+
+                if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
+                {
+                    vTaskSuspendAll();
+                    {
+                        /* Now the scheduler is suspended, the expected idle
+                         * time can be sampled again, and this time its value can
+                         * be used. */
+                        configASSERT( xNextTaskUnblockTime >= xTickCount );
+                        xExpectedIdleTime = prvGetExpectedIdleTime();
+
+                        /* Define the following macro to set xExpectedIdleTime to 0
+                         * if the application does not want
+                         * portSUPPRESS_TICKS_AND_SLEEP() to be called. */
+                        configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( xExpectedIdleTime );
+
+                        if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
+                        {
+                            traceLOW_POWER_IDLE_BEGIN();
+                            portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime );
+                            traceLOW_POWER_IDLE_END();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    ( void ) xTaskResumeAll();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_TICKLESS_IDLE */
+    }
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TICKLESS_IDLE != 0 )
+
+    eSleepModeStatus eTaskConfirmSleepModeStatus( void )
+    {
+        /* The idle task exists in addition to the application tasks. */
+        const UBaseType_t uxNonApplicationTasks = 1;
+        eSleepModeStatus eReturn = eStandardSleep;
+
+        /* This function must be called from a critical section. */
+
+        if( listCURRENT_LIST_LENGTH( &xPendingReadyList ) != 0 )
+        {
+            /* A task was made ready while the scheduler was suspended. */
+            eReturn = eAbortSleep;
+        }
+        else if( xYieldPending != pdFALSE )
+        {
+            /* A yield was pended while the scheduler was suspended. */
+            eReturn = eAbortSleep;
+        }
+        else if( xPendedTicks != 0 )
+        {
+            /* A tick interrupt has already occurred but was held pending
+             * because the scheduler is suspended. */
+            eReturn = eAbortSleep;
+        }
+        else
+        {
+            /* If all the tasks are in the suspended list (which might mean they
+             * have an infinite block time rather than actually being suspended)
+             * then it is safe to turn all clocks off and just wait for external
+             * interrupts. */
+            if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == ( uxCurrentNumberOfTasks - uxNonApplicationTasks ) )
+            {
+                eReturn = eNoTasksWaitingTimeout;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return eReturn;
+    }
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*-----------------------------------------------------------*/
+
+#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+
+    void vTaskSetThreadLocalStoragePointer( TaskHandle_t xTaskToSet,
+                                            BaseType_t xIndex,
+                                            void * pvValue )
+    {
+        TCB_t * pxTCB;
+
+        if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+        {
+            pxTCB = prvGetTCBFromHandle( xTaskToSet );
+            configASSERT( pxTCB != NULL );
+            pxTCB->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
+        }
+    }
+
+#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
+/*-----------------------------------------------------------*/
+
+#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+
+    void * pvTaskGetThreadLocalStoragePointer( TaskHandle_t xTaskToQuery,
+                                               BaseType_t xIndex )
+    {
+        void * pvReturn = NULL;
+        TCB_t * pxTCB;
+
+        if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+        {
+            pxTCB = prvGetTCBFromHandle( xTaskToQuery );
+            pvReturn = pxTCB->pvThreadLocalStoragePointers[ xIndex ];
+        }
+        else
+        {
+            pvReturn = NULL;
+        }
+
+        return pvReturn;
+    }
+
+#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
+/*-----------------------------------------------------------*/
+
+#if ( portUSING_MPU_WRAPPERS == 1 )
+
+    void vTaskAllocateMPURegions( TaskHandle_t xTaskToModify,
+                                  const MemoryRegion_t * const xRegions )
+    {
+        TCB_t * pxTCB;
+
+        /* If null is passed in here then we are modifying the MPU settings of
+         * the calling task. */
+        pxTCB = prvGetTCBFromHandle( xTaskToModify );
+
+        vPortStoreTaskMPUSettings( &( pxTCB->xMPUSettings ), xRegions, NULL, 0 );
+    }
+
+#endif /* portUSING_MPU_WRAPPERS */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseTaskLists( void )
+{
+    UBaseType_t uxPriority;
+
+    for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+    {
+        vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
+    }
+		
+		/* E.C. */
+		#if ( configUSE_EDF_SCHEDULER == 1 )
+		{
+			vListInitialise( &xReadyTasksListEDF );
+			vListInitialise( &xEDFReleasedTasks );
+		}
+		#endif
+
+    #if ( configUSE_EDF_ISR_RELEASE_QUEUE == 1 )
+        {
+            vListInitialise( &xEDFPendingReleases );
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) )
+        {
+            vListInitialise( &xEDFCeilingBlockedList );
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SHARED_STACK == 1 ) && ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 ) )
+        {
+            ( void ) memset( xEDFSharedStack, ( int ) tskSTACK_FILL_BYTE, sizeof( xEDFSharedStack ) );
+        }
+    #endif
+
+    vListInitialise( &xDelayedTaskList1 );
+    vListInitialise( &xDelayedTaskList2 );
+    vListInitialise( &xPendingReadyList );
+
+    #if ( configUSE_TIMING_WHEEL == 1 )
+        {
+            UBaseType_t uxSlot;
+
+            for( uxSlot = ( UBaseType_t ) 0U; uxSlot < ( UBaseType_t ) configTIMING_WHEEL_SLOTS; uxSlot++ )
+            {
+                vListInitialise( &( xTimingWheel[ 0 ][ uxSlot ] ) );
+                vListInitialise( &( xTimingWheel[ 1 ][ uxSlot ] ) );
+            }
+        }
+    #endif
+
+    #if ( INCLUDE_vTaskDelete == 1 )
+        {
+            vListInitialise( &xTasksWaitingTermination );
+        }
+    #endif /* INCLUDE_vTaskDelete */
+
+    #if ( INCLUDE_vTaskSuspend == 1 )
+        {
+            vListInitialise( &xSuspendedTaskList );
+        }
+    #endif /* INCLUDE_vTaskSuspend */
+
+    /* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
+     * using list2. */
+    pxDelayedTaskList = &xDelayedTaskList1;
+    pxOverflowDelayedTaskList = &xDelayedTaskList2;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckTasksWaitingTermination( void )
+{
+    /** THIS FUNCTION IS CALLED FROM THE RTOS IDLE TASK **/
+
+    #if ( INCLUDE_vTaskDelete == 1 )
+        {
+            TCB_t * pxTCB;
+
+            /* uxDeletedTasksWaitingCleanUp is used to prevent taskENTER_CRITICAL()
+             * being called too often in the idle task. */
+            while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
+            {
+                taskENTER_CRITICAL();
+                {
+                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                    --uxCurrentNumberOfTasks;
+                    --uxDeletedTasksWaitingCleanUp;
+                }
+                taskEXIT_CRITICAL();
+
+                prvDeleteTCB( pxTCB );
+            }
+        }
+    #endif /* INCLUDE_vTaskDelete */
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    void vTaskGetInfo( TaskHandle_t xTask,
+                       TaskStatus_t * pxTaskStatus,
+                       BaseType_t xGetFreeStackSpace,
+                       eTaskState eState )
+    {
+        TCB_t * pxTCB;
+
+        /* xTask is NULL then get the state of the calling task. */
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        pxTaskStatus->xHandle = ( TaskHandle_t ) pxTCB;
+        pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName[ 0 ] );
+        pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
+        pxTaskStatus->pxStackBase = pxTCB->pxStack;
+        pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
+
+        #if ( configUSE_MUTEXES == 1 )
+            {
+                pxTaskStatus->uxBasePriority = pxTCB->uxBasePriority;
+            }
+        #else
+            {
+                pxTaskStatus->uxBasePriority = 0;
+            }
+        #endif
+
+        #if ( configGENERATE_RUN_TIME_STATS == 1 )
+            {
+                pxTaskStatus->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
+            }
+        #else
+            {
+                pxTaskStatus->ulRunTimeCounter = ( configRUN_TIME_COUNTER_TYPE ) 0;
+            }
+        #endif
+
+        /* Obtaining the task state is a little fiddly, so is only done if the
+         * value of eState passed into this function is eInvalid - otherwise the
+         * state is just set to whatever is passed in. */
+        if( eState != eInvalid )
+        {
+            if( pxTCB == pxCurrentTCB )
+            {
+                pxTaskStatus->eCurrentState = eRunning;
+            }
+            else
+            {
+                pxTaskStatus->eCurrentState = eState;
+
+                #if ( INCLUDE_vTaskSuspend == 1 )
+                    {
+                        /* If the task is in the suspended list then there is a
+                         *  chance it is actually just blocked indefinitely - so really
+                         *  it should be reported as being in the Blocked state. */
+                        if( eState == eSuspended )
+                        {
+                            vTaskSuspendAll();
+                            {
+                                if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                                {
+                                    pxTaskStatus->eCurrentState = eBlocked;
+                                }
+                            }
+                            ( void ) xTaskResumeAll();
+                        }
+                    }
+                #endif /* INCLUDE_vTaskSuspend */
+            }
+        }
+        else
+        {
+            pxTaskStatus->eCurrentState = eTaskGetState( pxTCB );
+        }
+
+        /* Obtaining the stack space takes some time, so the xGetFreeStackSpace
+         * parameter is provided to allow it to be skipped. */
+        if( xGetFreeStackSpace != pdFALSE )
+        {
+            #if ( portSTACK_GROWTH > 0 )
+                {
+                    pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
+                }
+            #else
+                {
+                    pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
+                }
+            #endif
+        }
+        else
+        {
+            pxTaskStatus->usStackHighWaterMark = 0;
+        }
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t * pxTaskStatusArray,
+                                                     List_t * pxList,
+                                                     eTaskState eState )
+    {
+        configLIST_VOLATILE TCB_t * pxNextTCB, * pxFirstTCB;
+        UBaseType_t uxTask = 0;
+
+        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+        {
+            listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+            /* Populate an TaskStatus_t structure within the
+             * pxTaskStatusArray array for each task that is referenced from
+             * pxList.  See the definition of TaskStatus_t in task.h for the
+             * meaning of each TaskStatus_t structure member. */
+            do
+            {
+                listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                vTaskGetInfo( ( TaskHandle_t ) pxNextTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eState );
+                uxTask++;
+            } while( pxNextTCB != pxFirstTCB );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return uxTask;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+
+    static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
+    {
+        uint32_t ulCount = 0U;
+
+        while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
+        {
+            pucStackByte -= portSTACK_GROWTH;
+            ulCount++;
+        }
+
+        ulCount /= ( uint32_t ) sizeof( StackType_t ); /*lint !e961 Casting is not redundant on smaller architectures. */
+
+        return ( configSTACK_DEPTH_TYPE ) ulCount;
+    }
+
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
+
+/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are the
+ * same except for their return type.  Using configSTACK_DEPTH_TYPE allows the
+ * user to determine the return type.  It gets around the problem of the value
+ * overflowing on 8-bit types without breaking backward compatibility for
+ * applications that expect an 8-bit return type. */
+    configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        uint8_t * pucEndOfStack;
+        configSTACK_DEPTH_TYPE uxReturn;
+
+        /* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are
+         * the same except for their return type.  Using configSTACK_DEPTH_TYPE
+         * allows the user to determine the return type.  It gets around the
+         * problem of the value overflowing on 8-bit types without breaking
+         * backward compatibility for applications that expect an 8-bit return
+         * type. */
+
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        #if portSTACK_GROWTH < 0
+            {
+                pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+            }
+        #else
+            {
+                pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+            }
+        #endif
+
+        uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
+
+        return uxReturn;
+    }
+
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark2 */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
+
+    UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        uint8_t * pucEndOfStack;
+        UBaseType_t uxReturn;
+
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        #if portSTACK_GROWTH < 0
+            {
+                pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+            }
+        #else
+            {
+                pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+            }
+        #endif
+
+        uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
+
+        return uxReturn;
+    }
+
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskDelete == 1 )
+
+    static void prvDeleteTCB( TCB_t * pxTCB )
+    {
+        /* This call is required specifically for the TriCore port.  It must be
+         * above the vPortFree() calls.  The call is also used by ports/demos that
+         * want to allocate and clean RAM statically. */
+        portCLEAN_UP_TCB( pxTCB );
+
+        /* Free up the memory allocated by the scheduler for the task.  It is up
+         * to the task to free any memory allocated at the application level.
+         * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
+         * for additional information. */
+        #if ( configUSE_NEWLIB_REENTRANT == 1 )
+            {
+                _reclaim_reent( &( pxTCB->xNewLib_reent ) );
+            }
+        #endif /* configUSE_NEWLIB_REENTRANT */
+
+        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
+            {
+                /* The task can only have been allocated dynamically - free both
+                 * the stack and TCB, unless the task used the shared stack. */
+                if( taskEDF_STACK_IS_SHARED( pxTCB ) == pdFALSE )
+                {
+                    vPortFreeStack( pxTCB->pxStack );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                vPortFree( pxTCB );
+            }
+        #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
+            {
+                /* The task could have been allocated statically or dynamically, so
+                 * check what was statically allocated before trying to free the
+                 * memory. */
+                if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+                {
+                    /* Both the stack and TCB were allocated dynamically, so both
+                     * must be freed. */
+                    vPortFreeStack( pxTCB->pxStack );
+                    vPortFree( pxTCB );
+                }
+                else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+                {
+                    /* Only the stack was statically allocated, so the TCB is the
+                     * only memory that must be freed. */
+                    vPortFree( pxTCB );
+                }
+                else
+                {
+                    /* Neither the stack nor the TCB were allocated dynamically, so
+                     * nothing needs to be freed. */
+                    configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+    }
+
+#endif /* INCLUDE_vTaskDelete */
+/*-----------------------------------------------------------*/
+
+static void prvResetNextTaskUnblockTime( void )
+{
+    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+    {
+        /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
+         * the maximum possible value so it is  extremely unlikely that the
+         * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+         * there is an item in the delayed list. */
+        xNextTaskUnblockTime = portMAX_DELAY;
+    }
+    else
+    {
+        /* The new current delayed list is not empty, get the value of
+         * the item at the head of the delayed list.  This is the time at
+         * which the task at the head of the delayed list should be removed
+         * from the Blocked state. */
+        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+    }
+
+    #if ( configUSE_TIMING_WHEEL == 1 )
+        {
+            prvTimingWheelLimitUnblockTime();
+        }
+    #endif
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvUnblockTaskAtWakeTime( TCB_t * pxTCB )
+{
+    BaseType_t xSwitchRequired = pdFALSE;
+
+    /* It is time to remove the item from the Blocked state. */
+    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+
+    /* Is the task waiting on an event also?  If so remove
+     * it from the event list. */
+    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+    {
+        listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        {
+            /* Harmonic periods release several tasks on the same tick.  They
+             * are sorted here, among themselves only, and
+             * prvEDFReadyReleasedTasks() adds them to the ready queue and
+             * decides on preemption once for all of them. */
+            traceMOVED_TASK_TO_READY_STATE( pxTCB );
+            taskEDF_CBS_WAKE( pxTCB );
+
+            if( taskEDF_SRP_HOLD_BACK( pxTCB ) == pdFALSE )
+            {
+                listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), taskEDF_DEADLINE( pxTCB ) );
+                prvEDFListInsert( &xEDFReleasedTasks, &( pxTCB->xStateListItem ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB );
+        }
+    #else /* configUSE_EDF_SCHEDULER */
+        {
+            /* Place the unblocked task into the appropriate ready
+             * list. */
+            prvAddTaskToReadyList( pxTCB );
+
+            /* A task being unblocked cannot cause an immediate
+             * context switch if preemption is turned off. */
+            #if ( configUSE_PREEMPTION == 1 )
+                {
+                    /* Preemption is on, but a context switch should only be performed
+                     * if the unblocked task has a priority that is equal to or higher
+                     * than the currently executing task. */
+                    if( taskWOKEN_TASK_PREEMPTS( pxTCB, ( pxTCB->uxPriority >= pxCurrentTCB->uxPriority ) ) != pdFALSE )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif /* configUSE_PREEMPTION */
+        }
+    #endif /* configUSE_EDF_SCHEDULER */
+
+    return xSwitchRequired;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static BaseType_t prvEDFReadyReleasedTasks( const BaseType_t xCheckPreemption )
+    {
+        ListItem_t * pxItem;
+        TCB_t * pxFirstTCB;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        #if ( ( configUSE_EDF_HEAP_READY_QUEUE == 0 ) && ( configUSE_EDF_BUCKET_READY_QUEUE == 0 ) )
+            ListItem_t * pxIterator = ( ListItem_t * ) &( xReadyTasksListEDF.xListEnd ); /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM, as in list.c. */
+        #endif
+
+        if( listLIST_IS_EMPTY( &xEDFReleasedTasks ) == pdFALSE )
+        {
+            pxFirstTCB = listGET_OWNER_OF_HEAD_ENTRY( &xEDFReleasedTasks ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+            while( listLIST_IS_EMPTY( &xEDFReleasedTasks ) == pdFALSE )
+            {
+                pxItem = listGET_HEAD_ENTRY( &xEDFReleasedTasks );
+                listREMOVE_ITEM( pxItem );
+
+                #if ( ( configUSE_EDF_HEAP_READY_QUEUE == 0 ) && ( configUSE_EDF_BUCKET_READY_QUEUE == 0 ) )
+                    {
+                        /* The released tasks come in deadline order, so the
+                         * search for each carries on from where the one
+                         * before it went, after the tasks with the same
+                         * deadline as prvEDFListInsert() would place it. */
+                        while( ( pxIterator->pxNext != ( ListItem_t * ) &( xReadyTasksListEDF.xListEnd ) ) &&
+                               ( taskEDF_TICK_IS_AFTER( pxIterator->pxNext->xItemValue, pxItem->xItemValue ) == pdFALSE ) )
+                        {
+                            pxIterator = pxIterator->pxNext;
+                        }
+
+                        pxItem->pxNext = pxIterator->pxNext;
+                        pxItem->pxNext->pxPrevious = pxItem;
+                        pxItem->pxPrevious = pxIterator;
+                        pxIterator->pxNext = pxItem;
+                        pxItem->pxContainer = &xReadyTasksListEDF;
+                        ( xReadyTasksListEDF.uxNumberOfItems )++;
+                        pxIterator = pxItem;
+                    }
+                #else
+                    {
+                        listINSERT_END( &xReadyTasksListEDF, pxItem );
+                        taskEDF_INSERT_READY_QUEUE( ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxItem ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                    }
+                #endif
+            }
+
+            /* None of the others can preempt if the first does not. */
+            #if ( configUSE_PREEMPTION == 1 )
+                {
+                    if( ( xCheckPreemption != pdFALSE ) &&
+                        ( taskWOKEN_TASK_PREEMPTS( pxFirstTCB, ( pxFirstTCB->uxPriority >= pxCurrentTCB->uxPriority ) ) != pdFALSE ) )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #else
+                {
+                    ( void ) pxFirstTCB;
+                    ( void ) xCheckPreemption;
+                }
+            #endif /* configUSE_PREEMPTION */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xSwitchRequired;
+    }
+
+#endif /* configUSE_EDF_SCHEDULER */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_ISR_RELEASE_QUEUE == 1 )
+
+    static void prvEDFDeferRelease( TCB_t * const pxTCB )
+    {
+        traceMOVED_TASK_TO_READY_STATE( pxTCB );
+
+        /* The server deadline is needed now to decide on preemption. */
+        taskEDF_CBS_WAKE( pxTCB );
+
+        if( taskEDF_SRP_HOLD_BACK( pxTCB ) == pdFALSE )
+        {
+            listINSERT_END( &xEDFPendingReleases, &( pxTCB->xStateListItem ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB );
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFReadyPendingReleases( void )
+    {
+        ListItem_t * pxItem;
+
+        while( listLIST_IS_EMPTY( &xEDFPendingReleases ) == pdFALSE )
+        {
+            pxItem = listGET_HEAD_ENTRY( &xEDFPendingReleases );
+            listREMOVE_ITEM( pxItem );
+
+            /* The deadline can have been inherited since the task was woken. */
+            listSET_LIST_ITEM_VALUE( pxItem, taskEDF_DEADLINE( ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxItem ) ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+            prvEDFListInsert( &xEDFReleasedTasks, pxItem );
+        }
+
+        /* Preemption was decided when each task was woken. */
+        ( void ) prvEDFReadyReleasedTasks( pdFALSE );
+    }
+
+#endif /* configUSE_EDF_ISR_RELEASE_QUEUE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMING_WHEEL == 1 )
+
+    static void prvTimingWheelInsert( ListItem_t * const pxItem )
+    {
+        const TickType_t xTimeToWake = listGET_LIST_ITEM_VALUE( pxItem );
+        const TickType_t xTicksAhead = xTimeToWake - xTickCount;
+        TickType_t xWheelTime;
+        UBaseType_t uxLevel, uxSlot;
+
+        if( xTicksAhead < ( TickType_t ) configTIMING_WHEEL_SLOTS )
+        {
+            uxLevel = ( UBaseType_t ) 0U;
+            uxSlot = ( UBaseType_t ) ( xTimeToWake & taskTIMING_WHEEL_MASK );
+            xWheelTime = xTimeToWake;
+        }
+        else
+        {
+            /* The task is moved down when the tick count reaches the start of
+             * the run of ticks it is due in. */
+            configASSERT( xTicksAhead < taskTIMING_WHEEL_SPAN );
+            uxLevel = ( UBaseType_t ) 1U;
+            uxSlot = ( UBaseType_t ) ( ( xTimeToWake / ( TickType_t ) configTIMING_WHEEL_SLOTS ) & taskTIMING_WHEEL_MASK );
+            xWheelTime = xTimeToWake & ~taskTIMING_WHEEL_MASK;
+        }
+
+        listINSERT_END( &( xTimingWheel[ uxLevel ][ uxSlot ] ), pxItem );
+        ulTimingWheelMap[ uxLevel ][ uxSlot >> 5 ] |= 1UL << ( uxSlot & 31U );
+
+        /* A time that has overflowed is picked up when the tick count does. */
+        if( ( xWheelTime >= xTickCount ) && ( xWheelTime < xNextTaskUnblockTime ) )
+        {
+            xNextTaskUnblockTime = xWheelTime;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvTimingWheelTick( const TickType_t xTickNow )
+    {
+        const UBaseType_t uxSlot = ( UBaseType_t ) ( xTickNow & taskTIMING_WHEEL_MASK );
+        UBaseType_t uxUpperSlot;
+        List_t * pxSlot;
+        ListItem_t * pxItem;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        if( uxSlot == ( UBaseType_t ) 0U )
+        {
+            /* A new run of ticks starts, so the tasks due in it move down to
+             * the first level.  The one due now goes into uxSlot, which is
+             * emptied below. */
+            uxUpperSlot = ( UBaseType_t ) ( ( xTickNow / ( TickType_t ) configTIMING_WHEEL_SLOTS ) & taskTIMING_WHEEL_MASK );
+            pxSlot = &( xTimingWheel[ 1 ][ uxUpperSlot ] );
+
+            while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+            {
+                pxItem = listGET_HEAD_ENTRY( pxSlot );
+                listREMOVE_ITEM( pxItem );
+                prvTimingWheelInsert( pxItem );
+            }
+
+            ulTimingWheelMap[ 1 ][ uxUpperSlot >> 5 ] &= ~( 1UL << ( uxUpperSlot & 31U ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxSlot = &( xTimingWheel[ 0 ][ uxSlot ] );
+
+        while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+        {
+            configASSERT( listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxSlot ) == xTickNow );
+
+            if( prvUnblockTaskAtWakeTime( listGET_OWNER_OF_HEAD_ENTRY( pxSlot ) ) != pdFALSE ) /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+            {
+                xSwitchRequired = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        ulTimingWheelMap[ 0 ][ uxSlot >> 5 ] &= ~( 1UL << ( uxSlot & 31U ) );
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static UBaseType_t prvTimingWheelFindSlot( const UBaseType_t uxLevel,
+                                               const UBaseType_t uxFrom )
+    {
+        UBaseType_t uxSlot = uxFrom;
+        UBaseType_t uxFound;
+        UBaseType_t uxWordsLeft = ( UBaseType_t ) taskTIMING_WHEEL_MAP_WORDS + ( UBaseType_t ) 1U;
+        uint32_t ulBits;
 
-                    /* Is the task waiting on an event also?  If so remove
-                     * it from the event list. */
-                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+        /* Returns how many slots after uxFrom, going round the wheel, the
+         * first slot that holds tasks is, or configTIMING_WHEEL_SLOTS if none
+         * do.  The word holding uxFrom is looked at twice, as the wheel wraps
+         * back into it. */
+        while( uxWordsLeft > ( UBaseType_t ) 0U )
+        {
+            ulBits = ulTimingWheelMap[ uxLevel ][ uxSlot >> 5 ] & ( 0xFFFFFFFFUL << ( uxSlot & 31U ) );
+
+            if( ulBits != 0UL )
+            {
+                uxFound = ( uxSlot & ~( UBaseType_t ) 31U ) + taskFIND_FIRST_SET( ulBits );
+
+                if( listLIST_IS_EMPTY( &( xTimingWheel[ uxLevel ][ uxFound ] ) ) == pdFALSE )
+                {
+                    return ( uxFound - uxFrom ) & ( UBaseType_t ) taskTIMING_WHEEL_MASK;
+                }
+
+                /* The tasks of the slot have been woken some other way. */
+                ulTimingWheelMap[ uxLevel ][ uxFound >> 5 ] &= ~( 1UL << ( uxFound & 31U ) );
+            }
+            else
+            {
+                uxSlot = ( ( uxSlot | ( UBaseType_t ) 31U ) + ( UBaseType_t ) 1U ) & ( UBaseType_t ) taskTIMING_WHEEL_MASK;
+                uxWordsLeft--;
+            }
+        }
+
+        return ( UBaseType_t ) configTIMING_WHEEL_SLOTS;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvTimingWheelLimitUnblockTime( void )
+    {
+        const TickType_t xTickNow = xTickCount;
+        const TickType_t xRunNow = xTickNow / ( TickType_t ) configTIMING_WHEEL_SLOTS;
+        TickType_t xTicksAhead = portMAX_DELAY;
+        UBaseType_t uxOffset;
+
+        /* The first level slots after the one of the tick count. */
+        uxOffset = prvTimingWheelFindSlot( ( UBaseType_t ) 0U, ( UBaseType_t ) ( ( xTickNow + ( TickType_t ) 1U ) & taskTIMING_WHEEL_MASK ) );
+
+        if( uxOffset < ( UBaseType_t ) configTIMING_WHEEL_SLOTS )
+        {
+            xTicksAhead = ( TickType_t ) uxOffset + ( TickType_t ) 1U;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* The second level slots, which are due when their run starts.  The
+         * one of the current run holds the run a whole turn later. */
+        uxOffset = prvTimingWheelFindSlot( ( UBaseType_t ) 1U, ( UBaseType_t ) ( ( xRunNow + ( TickType_t ) 1U ) & taskTIMING_WHEEL_MASK ) );
+
+        if( ( uxOffset < ( UBaseType_t ) configTIMING_WHEEL_SLOTS ) &&
+            ( ( TickType_t ) ( ( ( xRunNow + ( TickType_t ) uxOffset + ( TickType_t ) 1U ) * ( TickType_t ) configTIMING_WHEEL_SLOTS ) - xTickNow ) < xTicksAhead ) )
+        {
+            xTicksAhead = ( ( xRunNow + ( TickType_t ) uxOffset + ( TickType_t ) 1U ) * ( TickType_t ) configTIMING_WHEEL_SLOTS ) - xTickNow;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* A time that has overflowed is picked up when the tick count does. */
+        if( ( xTicksAhead != portMAX_DELAY ) &&
+            ( ( TickType_t ) ( xTickNow + xTicksAhead ) > xTickNow ) &&
+            ( ( TickType_t ) ( xTickNow + xTicksAhead ) < xNextTaskUnblockTime ) )
+        {
+            xNextTaskUnblockTime = xTickNow + xTicksAhead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_TIMING_WHEEL */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvAddNewTaskToDelayedList( TCB_t * pxNewTCB )
+    {
+        const TickType_t xTimeToWake = xTickCount + taskEDF_TICKS_UNTIL( pxNewTCB->xReleaseTime, xTickCount );
+
+        listSET_LIST_ITEM_VALUE( &( pxNewTCB->xStateListItem ), xTimeToWake );
+
+        #if ( configUSE_TIMING_WHEEL == 1 )
+            if( taskTIMING_WHEEL_HOLDS( xTimeToWake - xTickCount ) != pdFALSE )
+            {
+                prvTimingWheelInsert( &( pxNewTCB->xStateListItem ) );
+
+                #if ( configUSE_EDF_EVENT_TICK == 1 )
                     {
-                        listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+                        if( xSchedulerRunning != pdFALSE )
+                        {
+                            prvEDFSetNextEvent();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
                     }
-                    else
+                #endif
+            }
+            else
+        #endif
+        if( xTimeToWake < xTickCount )
+        {
+            /* Wake time has overflowed.  Place this item in the overflow
+             * list. */
+            vListInsert( pxOverflowDelayedTaskList, &( pxNewTCB->xStateListItem ) );
+        }
+        else
+        {
+            vListInsert( pxDelayedTaskList, &( pxNewTCB->xStateListItem ) );
+
+            /* If the task entering the blocked state was placed at the head of
+             * the list of blocked tasks then xNextTaskUnblockTime needs to be
+             * updated too.  Before the scheduler starts it is recalculated in
+             * vTaskStartScheduler() instead. */
+            if( xTimeToWake < xNextTaskUnblockTime )
+            {
+                xNextTaskUnblockTime = xTimeToWake;
+
+                #if ( configUSE_EDF_EVENT_TICK == 1 )
                     {
-                        mtCOVERAGE_TEST_MARKER();
+                        if( xSchedulerRunning != pdFALSE )
+                        {
+                            prvEDFSetNextEvent();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
                     }
-														
-										/* E.C. */
-										#if (configUSE_EDF_SCHEDULER == 1)
-											listSET_LIST_ITEM_VALUE(&(pxTCB->xStateListItem), pxTCB->xTaskPeriod + listGET_LIST_ITEM_VALUE(&(pxTCB->xStateListItem)));
-										#endif
+                #endif
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
 
-                    /* Place the unblocked task into the appropriate ready
-                     * list. */
-                    prvAddTaskToReadyList( pxTCB );
+    static void prvEDFInitialisePeriodicTask( TCB_t * const pxNewTCB,
+                                              const TickType_t xPeriod,
+                                              const TickType_t xRelativeDeadline,
+                                              const TickType_t xWCET,
+                                              const TickType_t xPhase )
+    {
+        pxNewTCB->xTaskPeriod = xPeriod;
+        pxNewTCB->xRelativeDeadline = xRelativeDeadline;
+        pxNewTCB->xWCET = xWCET;
+        pxNewTCB->xPhase = xPhase;
+
+        /* The first job is released xPhase ticks after the release epoch, or
+         * after now if the scheduler is already running, and is due
+         * xRelativeDeadline ticks after its release. */
+        if( xSchedulerRunning == pdFALSE )
+        {
+            pxNewTCB->xReleaseTime = xEDFReleaseEpoch + xPhase;
+        }
+        else
+        {
+            pxNewTCB->xReleaseTime = taskEDF_TIME_NOW( xTaskGetTickCount() ) + xPhase;
+        }
 
-                    /* A task being unblocked cannot cause an immediate
-                     * context switch if preemption is turned off. */
-                    #if ( configUSE_PREEMPTION == 1 )
-                        {
-                            /* Preemption is on, but a context switch should
-                             * only be performed if the unblocked task has a
-                             * priority that is equal to or higher than the
-                             * currently executing task. */
-										
-														#if (configUSE_EDF_SCHEDULER == 0)
-															if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
-															{
-																	xSwitchRequired = pdTRUE;
-															}
-															else
-															{
-																	mtCOVERAGE_TEST_MARKER();
-															}
-														#else
-															if( listGET_LIST_ITEM_VALUE(&(pxTCB->xStateListItem)) <= listGET_LIST_ITEM_VALUE(&(pxCurrentTCB->xStateListItem)) )
-															{
-																	xSwitchRequired = pdTRUE;
-															}
-															else
-															{
-																	mtCOVERAGE_TEST_MARKER();
-															}
-														#endif
-														
+        pxNewTCB->xAbsoluteDeadline = pxNewTCB->xReleaseTime + xRelativeDeadline;
+    }
+/*-----------------------------------------------------------*/
 
-                        }
-                    #endif /* configUSE_PREEMPTION */
+    static void prvEDFListInsert( List_t * const pxList,
+                                  ListItem_t * const pxNewListItem )
+    {
+        ListItem_t * pxIterator;
+        const TickType_t xValueOfInsertion = pxNewListItem->xItemValue;
+
+        /* Walk past every item that is not after the new one, which keeps items
+         * with equal values in FIFO order as vListInsert() does.  The end
+         * marker is not compared, so no value needs special handling. */
+        for( pxIterator = ( ListItem_t * ) &( pxList->xListEnd );
+             ( pxIterator->pxNext != ( ListItem_t * ) &( pxList->xListEnd ) ) &&
+             ( taskEDF_TICK_IS_AFTER( pxIterator->pxNext->xItemValue, xValueOfInsertion ) == pdFALSE );
+             pxIterator = pxIterator->pxNext ) /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM, as in list.c. */
+        {
+            /* There is nothing to do here, just iterating to the wanted
+             * insertion position. */
+        }
+
+        pxNewListItem->pxNext = pxIterator->pxNext;
+        pxNewListItem->pxNext->pxPrevious = pxNewListItem;
+        pxNewListItem->pxPrevious = pxIterator;
+        pxIterator->pxNext = pxNewListItem;
+        pxNewListItem->pxContainer = pxList;
+
+        ( pxList->uxNumberOfItems )++;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFWokenTaskPreempts( const TCB_t * const pxTCB,
+                                               const BaseType_t xHigherPriority )
+    {
+        BaseType_t xReturn;
+
+        if( ( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( pxTCB->xStateListItem ) ) == pdFALSE ) &&
+            ( taskEDF_IS_PENDING_RELEASE( pxTCB ) == pdFALSE ) )
+        {
+            /* The task is held pending until the scheduler is resumed, where
+             * the decision is made again, or SRP is holding it back. */
+            xReturn = pdFALSE;
+        }
+        else if( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( pxCurrentTCB->xStateListItem ) ) == pdFALSE )
+        {
+            /* The running task is the idle task, which is never in the ready
+             * queue, or is leaving the Ready state. */
+            xReturn = pdTRUE;
+        }
+        else if( taskEDF_TICK_IS_AFTER( taskEDF_DEADLINE( pxCurrentTCB ), taskEDF_DEADLINE( pxTCB ) ) )
+        {
+            xReturn = pdTRUE;
+        }
+
+        #if ( configEDF_TIE_BREAK == tskEDF_TIE_FIFO )
+            else if( ( taskEDF_DEADLINE( pxTCB ) == taskEDF_DEADLINE( pxCurrentTCB ) ) &&
+                     ( taskEDF_TICK_IS_AFTER( pxCurrentTCB->xReleaseTime, pxTCB->xReleaseTime ) ) )
+            {
+                /* The woken job was released first.  The running task goes
+                 * behind it, as the ready queue keeps equal deadlines in the
+                 * order the tasks were added. */
+                #if ( configUSE_EDF_ISR_RELEASE_QUEUE == 1 )
+                    if( taskEDF_IS_PENDING_RELEASE( pxTCB ) != pdFALSE )
+                    {
+                        /* This may be an interrupt, so rather than the pending
+                         * releases being moved to the ready queue here, the
+                         * running task is appended to them, in constant time.
+                         * prvEDFReadyPendingReleases() keeps their order. */
+                        ( void ) uxListRemove( &( pxCurrentTCB->xStateListItem ) );
+                        taskEDF_RESET_READY_QUEUE( pxCurrentTCB );
+                        listINSERT_END( &xEDFPendingReleases, &( pxCurrentTCB->xStateListItem ) );
+                    }
+                    else
+                #endif
+                {
+                    ( void ) prvEDFRequeueCurrentTask();
                 }
+
+                uxEDFTieSwitches++;
+                xReturn = pdTRUE;
+            }
+        #endif
+        else
+        {
+            /* A task with an equal deadline does not preempt unless
+             * configEDF_TIE_BREAK says so above, as switching to it would not
+             * make either of them meet its deadline sooner.  The counts may
+             * miss an increment made by an interrupt, which is good enough for
+             * a statistic. */
+            if( taskEDF_DEADLINE( pxTCB ) == taskEDF_DEADLINE( pxCurrentTCB ) )
+            {
+                uxEDFTiesKept++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( xHigherPriority != pdFALSE )
+            {
+                uxEDFAvoidedPreemptions++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
             }
+
+            xReturn = pdFALSE;
         }
 
-        /* Tasks of equal priority to the currently running task will share
-         * processing time (time slice) if preemption is on, and the application
-         * writer has not explicitly turned time slicing off. */
-        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+        return xReturn;
+    }
+
+#endif /* configUSE_EDF_SCHEDULER */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( ( configUSE_EDF_CBS == 1 ) || ( configUSE_EDF_DEADLINE_INHERITANCE == 1 ) ) )
+
+    static void prvEDFResortEventListItem( TCB_t * const pxTCB )
+    {
+        List_t * const pxEventList = listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) );
+
+        /* The item may be in an unordered or FIFO event list, or in the pending
+         * ready list, whose order does not depend on the deadline. */
+        if( ( pxEventList != NULL ) && ( pxEventList != &xPendingReadyList ) && ( pxTCB->xEventListItemOnDeadline != pdFALSE ) )
+        {
+            ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+            listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), taskEDF_DEADLINE( pxTCB ) );
+            prvEDFListInsert( pxEventList, &( pxTCB->xEventListItem ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( ( configUSE_EDF_CBS == 1 ) || ( configUSE_EDF_DEADLINE_INHERITANCE == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FINE_TIME == 1 ) )
+
+    static TickType_t prvEDFTimeNow( const TickType_t xTickNow )
+    {
+        uint32_t ulCounts = ( uint32_t ) portEDF_GET_BUDGET_COUNTER() - ulEDFCounterAtTick;
+
+        #if ( configUSE_EDF_EVENT_TICK == 1 )
             {
-                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+                /* xTickNow already includes the whole ticks. */
+                ulCounts %= ( uint32_t ) configEDF_BUDGET_COUNTS_PER_TICK;
+            }
+        #else
+            {
+                if( ulCounts >= ( uint32_t ) configEDF_BUDGET_COUNTS_PER_TICK )
                 {
-                    xSwitchRequired = pdTRUE;
+                    /* The counter has run ahead of the tick, or the tick is
+                     * held pending while the scheduler is suspended. */
+                    ulCounts = ( uint32_t ) configEDF_BUDGET_COUNTS_PER_TICK - 1UL;
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
-        #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+        #endif
 
-        #if ( configUSE_TICK_HOOK == 1 )
+        return taskEDF_TIME_FROM_TICKS( xTickNow ) + ( TickType_t ) ulCounts;
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FINE_TIME == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_EVENT_TICK == 1 )
+
+    static BaseType_t prvEDFCountTicks( void )
+    {
+        TickType_t xTicks = ( TickType_t ) ( ( ( uint32_t ) portEDF_GET_BUDGET_COUNTER() - ulEDFCounterAtTick ) / ( uint32_t ) configEDF_BUDGET_COUNTS_PER_TICK );
+        TickType_t xTicksToJump;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        /* Advance by whole ticks so the tick count does not drift from the
+         * counter. */
+        ulEDFCounterAtTick += ( uint32_t ) xTicks * ( uint32_t ) configEDF_BUDGET_COUNTS_PER_TICK;
+
+        if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+        {
+            /* Nothing can fall due before xNextTaskUnblockTime other than the
+             * deadline and budget events, which are only checked against the
+             * time now, so the ticks before the last can be stepped over as
+             * long as they do not reach it.  That also keeps the tick count
+             * short of the overflow, which has to be counted. */
+            if( ( xTicks > ( TickType_t ) 1U ) && ( xNextTaskUnblockTime > xTickCount ) )
             {
-                /* Guard against the tick hook being called when the pended tick
-                 * count is being unwound (when the scheduler is being unlocked). */
-                if( xPendedTicks == ( TickType_t ) 0 )
+                xTicksToJump = xTicks - ( TickType_t ) 1U;
+
+                if( xTicksToJump > ( TickType_t ) ( xNextTaskUnblockTime - xTickCount - ( TickType_t ) 1U ) )
                 {
-                    vApplicationTickHook();
+                    xTicksToJump = xNextTaskUnblockTime - xTickCount - ( TickType_t ) 1U;
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
+
+                xTickCount += xTicksToJump;
+                xTicks -= xTicksToJump;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
             }
-        #endif /* configUSE_TICK_HOOK */
 
-        #if ( configUSE_PREEMPTION == 1 )
+            while( xTicks > ( TickType_t ) 0U )
             {
-                if( xYieldPending != pdFALSE )
+                if( xTaskIncrementTick() != pdFALSE )
                 {
                     xSwitchRequired = pdTRUE;
                 }
@@ -3050,1162 +7339,1413 @@ BaseType_t xTaskIncrementTick( void )
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
-            }
-        #endif /* configUSE_PREEMPTION */
-    }
-    else
-    {
-        ++xPendedTicks;
 
-        /* The tick hook gets called at regular intervals, even if the
-         * scheduler is locked. */
-        #if ( configUSE_TICK_HOOK == 1 )
-            {
-                vApplicationTickHook();
+                xTicks--;
             }
-        #endif
-    }
+        }
+        else
+        {
+            /* xTaskResumeAll() counts them. */
+            xPendedTicks += xTicks;
+        }
 
-    return xSwitchRequired;
-}
+        return xSwitchRequired;
+    }
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
-
-    void vTaskSetApplicationTaskTag( TaskHandle_t xTask,
-                                     TaskHookFunction_t pxHookFunction )
+    static void prvEDFSetNextEvent( void )
     {
-        TCB_t * xTCB;
+        const TickType_t xTicksCounted = xTickCount + xPendedTicks;
+        TickType_t xTicksToEvent = ( TickType_t ) ( 0x7FFFFFFFUL / ( uint32_t ) configEDF_BUDGET_COUNTS_PER_TICK );
 
-        /* If xTask is NULL then it is the task hook of the calling task that is
-         * getting set. */
-        if( xTask == NULL )
+        /* The compare only covers half the range of the counter, and the tick
+         * count has to be counted through its overflow. */
+        if( ( ( TickType_t ) ( ( TickType_t ) 0U - xTicksCounted ) != ( TickType_t ) 0U ) &&
+            ( ( TickType_t ) ( ( TickType_t ) 0U - xTicksCounted ) < xTicksToEvent ) )
         {
-            xTCB = ( TCB_t * ) pxCurrentTCB;
+            xTicksToEvent = ( TickType_t ) 0U - xTicksCounted;
         }
         else
         {
-            xTCB = xTask;
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* The next release, or the next task to wake.  While the scheduler is
+         * suspended the ticks are only held pending, so are counted one at a
+         * time. */
+        if( ( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE ) || ( xNextTaskUnblockTime <= xTicksCounted ) )
+        {
+            xTicksToEvent = ( TickType_t ) 1U;
+        }
+        else if( ( TickType_t ) ( xNextTaskUnblockTime - xTicksCounted ) < xTicksToEvent )
+        {
+            xTicksToEvent = xNextTaskUnblockTime - xTicksCounted;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
 
-        /* Save the hook function in the TCB.  A critical section is required as
-         * the value can be accessed from an interrupt. */
-        taskENTER_CRITICAL();
-        {
-            xTCB->pxTaskTag = pxHookFunction;
-        }
-        taskEXIT_CRITICAL();
-    }
+        #if ( configUSE_EDF_DEADLINE_MISS_DETECTION == 1 )
+            {
+                TCB_t * pxTCB = pxCurrentTCB;
+                UBaseType_t x;
+
+                /* The first tick after the deadline of the running job, or of
+                 * a Ready job with an earlier deadline, as checked by the tick
+                 * handler. */
+                for( x = 0; x < ( UBaseType_t ) 2U; x++ )
+                {
+                    if( ( pxTCB != NULL ) && ( pxTCB != xIdleTaskHandle ) && ( pxTCB->xDeadlineMissed == pdFALSE ) )
+                    {
+                        if( taskEDF_TICK_IS_AFTER( taskEDF_TIME_FROM_TICKS( xTicksCounted ), pxTCB->xAbsoluteDeadline ) != pdFALSE )
+                        {
+                            xTicksToEvent = ( TickType_t ) 1U;
+                        }
+                        else if( taskEDF_TICKS_UNTIL( pxTCB->xAbsoluteDeadline + ( TickType_t ) 1U, xTicksCounted ) < xTicksToEvent )
+                        {
+                            xTicksToEvent = taskEDF_TICKS_UNTIL( pxTCB->xAbsoluteDeadline + ( TickType_t ) 1U, xTicksCounted );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    pxTCB = taskEDF_GET_EARLIEST_DEADLINE_TASK();
+                }
+            }
+        #endif /* configUSE_EDF_DEADLINE_MISS_DETECTION */
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
-/*-----------------------------------------------------------*/
+        #if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+            {
+                /* The first tick at which the running job has been charged its
+                 * whole budget, if it keeps running. */
+                if( ( pxCurrentTCB->xWCET != ( TickType_t ) 0U ) &&
+                    ( pxCurrentTCB->xBudgetExhausted == pdFALSE ) &&
+                    ( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( pxCurrentTCB->xStateListItem ) ) != pdFALSE ) )
+                {
+                    const uint32_t ulBudget = taskEDF_BUDGET_FROM_TICKS( pxCurrentTCB->xWCET );
+                    uint32_t ulCountsToEvent = 0UL;
+                    TickType_t xTicksToBudget;
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+                    if( pxCurrentTCB->ulBudgetUsed < ulBudget )
+                    {
+                        ulCountsToEvent = ( ulEDFBudgetChargedTime + ( ulBudget - pxCurrentTCB->ulBudgetUsed ) ) - ulEDFCounterAtTick;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
 
-    TaskHookFunction_t xTaskGetApplicationTaskTag( TaskHandle_t xTask )
-    {
-        TCB_t * pxTCB;
-        TaskHookFunction_t xReturn;
+                    xTicksToBudget = ( TickType_t ) ( ( ulCountsToEvent + ( uint32_t ) configEDF_BUDGET_COUNTS_PER_TICK - 1UL ) / ( uint32_t ) configEDF_BUDGET_COUNTS_PER_TICK );
 
-        /* If xTask is NULL then set the calling task's hook. */
-        pxTCB = prvGetTCBFromHandle( xTask );
+                    if( xTicksToBudget == ( TickType_t ) 0U )
+                    {
+                        xTicksToBudget = ( TickType_t ) 1U;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
 
-        /* Save the hook function in the TCB.  A critical section is required as
-         * the value can be accessed from an interrupt. */
-        taskENTER_CRITICAL();
-        {
-            xReturn = pxTCB->pxTaskTag;
-        }
-        taskEXIT_CRITICAL();
+                    if( xTicksToBudget < xTicksToEvent )
+                    {
+                        xTicksToEvent = xTicksToBudget;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_EDF_BUDGET_ENFORCEMENT */
 
-        return xReturn;
+        portEDF_SET_COMPARE( ulEDFCounterAtTick + ( ( uint32_t ) xTicksToEvent * ( uint32_t ) configEDF_BUDGET_COUNTS_PER_TICK ) );
     }
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
+#endif /* configUSE_EDF_EVENT_TICK */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DEADLINE_MISS_DETECTION == 1 ) )
 
-    TaskHookFunction_t xTaskGetApplicationTaskTagFromISR( TaskHandle_t xTask )
+    static void prvEDFDeadlineMissed( TCB_t * const pxTCB,
+                                      const TickType_t xTimeNow )
     {
-        TCB_t * pxTCB;
-        TaskHookFunction_t xReturn;
-        UBaseType_t uxSavedInterruptStatus;
+        /* The deadline of the idle task only orders it behind the other
+         * tasks, so it cannot be missed. */
+        if( ( pxTCB->xDeadlineMissed == pdFALSE ) && ( pxTCB != xIdleTaskHandle ) )
+        {
+            extern void vApplicationDeadlineMissHook( TaskHandle_t xTask,
+                                                      TickType_t xLateness );
 
-        /* If xTask is NULL then set the calling task's hook. */
-        pxTCB = prvGetTCBFromHandle( xTask );
+            pxTCB->xDeadlineMissed = pdTRUE;
+            pxTCB->uxDeadlineMisses++;
 
-        /* Save the hook function in the TCB.  A critical section is required as
-         * the value can be accessed from an interrupt. */
-        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+            /* Called from the tick interrupt, or from xTaskDelayUntil() with
+             * the scheduler suspended, so the hook must not block. */
+            vApplicationDeadlineMissHook( ( TaskHandle_t ) pxTCB, xTimeNow - pxTCB->xAbsoluteDeadline );
+        }
+        else
         {
-            xReturn = pxTCB->pxTaskTag;
+            mtCOVERAGE_TEST_MARKER();
         }
-        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
-
-        return xReturn;
     }
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DEADLINE_MISS_DETECTION == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+#if ( configUSE_EDF_JOB_RECORDS == 1 )
 
-    BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask,
-                                             void * pvParameter )
+    static void prvEDFRecordJob( const TickType_t xTimeNow )
     {
-        TCB_t * xTCB;
-        BaseType_t xReturn;
+        const UBaseType_t uxHead = uxEDFJobRecordHead;
+        EDFJobRecord_t * pxRecord;
 
-        /* If xTask is NULL then we are calling our own task hook. */
-        if( xTask == NULL )
-        {
-            xTCB = pxCurrentTCB;
-        }
-        else
+        if( ( UBaseType_t ) ( uxHead - uxEDFJobRecordTail ) < ( UBaseType_t ) configEDF_JOB_RECORD_COUNT )
         {
-            xTCB = xTask;
-        }
+            pxRecord = &( xEDFJobRecords[ uxHead & ( ( UBaseType_t ) configEDF_JOB_RECORD_COUNT - ( UBaseType_t ) 1U ) ] );
+            pxRecord->pxTask = pxCurrentTCB;
+            pxRecord->xReleaseTime = pxCurrentTCB->xReleaseTime;
+            pxRecord->ulStartTime = pxCurrentTCB->ulJobStartTime;
+            pxRecord->ulFinishTime = taskEDF_JOB_TIMESTAMP();
+            pxRecord->uxPreemptions = pxCurrentTCB->uxJobPreemptions;
 
-        if( xTCB->pxTaskTag != NULL )
-        {
-            xReturn = xTCB->pxTaskTag( pvParameter );
+            if( taskEDF_TICK_IS_AFTER( xTimeNow, pxCurrentTCB->xAbsoluteDeadline ) )
+            {
+                pxRecord->xLateness = xTimeNow - pxCurrentTCB->xAbsoluteDeadline;
+            }
+            else
+            {
+                pxRecord->xLateness = ( TickType_t ) 0U;
+            }
+
+            /* Publish the record now that it is complete. */
+            uxEDFJobRecordHead = uxHead + ( UBaseType_t ) 1U;
         }
         else
         {
-            xReturn = pdFAIL;
+            /* The consumer has fallen behind.  The record is dropped, rather
+             * than overwriting the oldest, which it may be reading. */
+            uxEDFJobRecordsLost++;
         }
 
-        return xReturn;
+        pxCurrentTCB->xJobStarted = pdFALSE;
+        pxCurrentTCB->uxJobPreemptions = ( UBaseType_t ) 0U;
     }
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
+#endif /* configUSE_EDF_JOB_RECORDS */
 /*-----------------------------------------------------------*/
 
-void vTaskSwitchContext( void )
-{
-    if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
-    {
-        /* The scheduler is currently suspended - do not allow a context
-         * switch. */
-        xYieldPending = pdTRUE;
-    }
-    else
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 ) )
+
+    static BaseType_t prvEDFBudgetExhausted( void )
     {
-        xYieldPending = pdFALSE;
-        traceTASK_SWITCHED_OUT();
+        TCB_t * const pxTCB = pxCurrentTCB;
+        BaseType_t xSwitchRequired = pdFALSE;
+        BaseType_t xServer = pdFALSE;
+        BaseType_t xPutOff = pdFALSE;
 
-        #if ( configGENERATE_RUN_TIME_STATS == 1 )
+        #if ( configUSE_EDF_CBS == 1 )
             {
-                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-                    portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime );
-                #else
-                    ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-                #endif
+                xServer = pxTCB->xCBSServer;
+            }
+        #endif
 
-                /* Add the amount of time the task has been running to the
-                 * accumulated time so far.  The time the task started running was
-                 * stored in ulTaskSwitchedInTime.  Note that there is no overflow
-                 * protection here so count values are only valid until the timer
-                 * overflows.  The guard against negative values is to protect
-                 * against suspect run time stat counter implementations - which
-                 * are provided by the application, not the kernel. */
-                if( ulTotalRunTime > ulTaskSwitchedInTime )
+        #if ( configUSE_EDF_SRP == 1 )
+            {
+                /* Only the actions that move the deadline are put off. */
+                if( ( pxTCB->uxSRPResourcesHeld != ( UBaseType_t ) 0U ) &&
+                    ( ( xServer != pdFALSE ) || ( configEDF_BUDGET_OVERRUN_ACTION != tskEDF_BUDGET_NOTIFY ) ) )
                 {
-                    pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
+                    xPutOff = pdTRUE;
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
-
-                ulTaskSwitchedInTime = ulTotalRunTime;
             }
-        #endif /* configGENERATE_RUN_TIME_STATS */
+        #endif
 
-        /* Check for stack overflow, if configured. */
-        taskCHECK_FOR_STACK_OVERFLOW();
+        if( xPutOff != pdFALSE )
+        {
+            /* A later deadline would take the task under the system ceiling it
+             * raised, so another user of the resource could run and lock it.
+             * The deadline is left alone until the task unlocks its last
+             * resource, and vTaskSRPUnlock() then acts on the overrun. */
+            pxTCB->xBudgetExhausted = pdTRUE;
+        }
+        else if( xServer != pdFALSE )
+        {
+            /* Using up its budget is how a server keeps to its bandwidth, so it
+             * is not an overrun.  The budget is filled again at once and the
+             * deadline moved one server period on. */
+            pxTCB->xReleaseTime += pxTCB->xTaskPeriod;
+            pxTCB->xAbsoluteDeadline += pxTCB->xTaskPeriod;
+            taskEDF_NEW_BUDGET();
 
-        /* Before the currently running task is switched out, save its errno. */
-        #if ( configUSE_POSIX_ERRNO == 1 )
-            {
-                pxCurrentTCB->iTaskErrno = FreeRTOS_errno;
-            }
-        #endif
+            #if ( configUSE_EDF_DEADLINE_MISS_DETECTION == 1 )
+                {
+                    pxTCB->xDeadlineMissed = pdFALSE;
+                }
+            #endif
 
-        /* Select a new task to run using either the generic C or port
-         * optimised asm code. */
-         
-				/* E.C. : */
-			  #if (configUSE_EDF_SCHEDULER == 0)
-			  {
-			  taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-			  }
-			  #else
-			  {
-			  pxCurrentTCB = (TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &(xReadyTasksListEDF ) );
-			  }
-			  #endif
-							
-        traceTASK_SWITCHED_IN();
+            xSwitchRequired = prvEDFRequeueCurrentTask();
+        }
+        else
+        {
+            #if ( configEDF_BUDGET_OVERRUN_ACTION == tskEDF_BUDGET_NOTIFY )
+                {
+                    /* The job is left to run, so only report it once. */
+                    if( pxTCB->xBudgetExhausted == pdFALSE )
+                    {
+                        extern void vApplicationBudgetOverrunHook( TaskHandle_t xTask );
 
-        /* After the new task is switched in, update the global errno. */
-        #if ( configUSE_POSIX_ERRNO == 1 )
-            {
-                FreeRTOS_errno = pxCurrentTCB->iTaskErrno;
-            }
-        #endif
+                        pxTCB->xBudgetExhausted = pdTRUE;
+                        pxTCB->uxBudgetOverruns++;
 
-        #if ( configUSE_NEWLIB_REENTRANT == 1 )
-            {
-                /* Switch Newlib's _impure_ptr variable to point to the _reent
-                 * structure specific to this task.
-                 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
-                 * for additional information. */
-                _impure_ptr = &( pxCurrentTCB->xNewLib_reent );
-            }
-        #endif /* configUSE_NEWLIB_REENTRANT */
-    }
-}
-/*-----------------------------------------------------------*/
+                        /* Called from the tick interrupt, so must not block. */
+                        vApplicationBudgetOverrunHook( ( TaskHandle_t ) pxTCB );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #else /* if ( configEDF_BUDGET_OVERRUN_ACTION == tskEDF_BUDGET_NOTIFY ) */
+                {
+                    BaseType_t xThrottle = pdFALSE;
+                    TickType_t xTickNow = ( TickType_t ) 0U;
 
-void vTaskPlaceOnEventList( List_t * const pxEventList,
-                            const TickType_t xTicksToWait )
-{
-    configASSERT( pxEventList );
+                    pxTCB->uxBudgetOverruns++;
 
-    /* THIS FUNCTION MUST BE CALLED WITH EITHER INTERRUPTS DISABLED OR THE
-     * SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED. */
+                    /* The rest of the job is carried on by the next release of
+                     * the task, with the budget and the deadline that go with
+                     * it.  xTaskDelayUntil() then holds the task to that
+                     * release. */
+                    pxTCB->xReleaseTime += pxTCB->xTaskPeriod;
+                    pxTCB->xAbsoluteDeadline = pxTCB->xReleaseTime + pxTCB->xRelativeDeadline;
+                    taskEDF_NEW_BUDGET();
 
-    /* Place the event list item of the TCB in the appropriate event list.
-     * This is placed in the list in priority order so the highest priority task
-     * is the first to be woken by the event.
-     *
-     * Note: Lists are sorted in ascending order by ListItem_t.xItemValue.
-     * Normally, the xItemValue of a TCB's ListItem_t members is:
-     *      xItemValue = ( configMAX_PRIORITIES - uxPriority )
-     * Therefore, the event list is sorted in descending priority order.
-     *
-     * The queue that contains the event list is locked, preventing
-     * simultaneous access from interrupts. */
-    vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+                    #if ( configUSE_EDF_DEADLINE_MISS_DETECTION == 1 )
+                        {
+                            pxTCB->xDeadlineMissed = pdFALSE;
+                        }
+                    #endif
 
-    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-}
+                    #if ( configEDF_BUDGET_OVERRUN_ACTION == tskEDF_BUDGET_THROTTLE )
+                        {
+                            /* A task that is already a period or more behind
+                             * has nothing to wait for, so stays Ready. */
+                            xTickNow = taskTICK_COUNT_NOW();
+                            xThrottle = taskEDF_TICK_IS_AFTER( pxTCB->xReleaseTime, taskEDF_TIME_NOW( xTickNow ) );
+
+                            /* A task holding a mutex also stays Ready, with its
+                             * new deadline.  Blocking it would keep the mutex
+                             * from the tasks waiting for it for up to a period.
+                             * xTaskDelayUntil() still holds the task to the
+                             * new release once the job completes. */
+                            #if ( configUSE_MUTEXES == 1 )
+                                {
+                                    if( pxTCB->uxMutexesHeld != ( UBaseType_t ) 0U )
+                                    {
+                                        xThrottle = pdFALSE;
+                                    }
+                                    else
+                                    {
+                                        mtCOVERAGE_TEST_MARKER();
+                                    }
+                                }
+                            #endif
+                        }
+                    #endif
+
+                    if( xThrottle != pdFALSE )
+                    {
+                        prvAddCurrentTaskToDelayedList( taskEDF_TICKS_UNTIL( pxTCB->xReleaseTime, xTickNow ), pdFALSE );
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        xSwitchRequired = prvEDFRequeueCurrentTask();
+                    }
+                }
+            #endif /* if ( configEDF_BUDGET_OVERRUN_ACTION == tskEDF_BUDGET_NOTIFY ) */
+        }
+
+        return xSwitchRequired;
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 ) */
 /*-----------------------------------------------------------*/
 
-void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
-                                     const TickType_t xItemValue,
-                                     const TickType_t xTicksToWait )
-{
-    configASSERT( pxEventList );
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 ) || ( configEDF_TIE_BREAK != tskEDF_TIE_KEEP_RUNNING ) ) )
 
-    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
-     * the event groups implementation. */
-    configASSERT( uxSchedulerSuspended != 0 );
+    static BaseType_t prvEDFRequeueCurrentTask( void )
+    {
+        BaseType_t xSwitchRequired;
 
-    /* Store the item value in the event list item.  It is safe to access the
-     * event list item here as interrupts won't access the event list item of a
-     * task that is not in the Blocked state. */
-    listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+        ( void ) uxListRemove( &( pxCurrentTCB->xStateListItem ) );
+        taskEDF_RESET_READY_QUEUE( pxCurrentTCB );
+        prvAddTaskToReadyList( pxCurrentTCB );
+
+        if( taskEDF_GET_EARLIEST_DEADLINE_TASK() != pxCurrentTCB )
+        {
+            xSwitchRequired = pdTRUE;
+        }
+        else
+        {
+            xSwitchRequired = pdFALSE;
+        }
 
-    /* Place the event list item of the TCB at the end of the appropriate event
-     * list.  It is safe to access the event list here because it is part of an
-     * event group implementation - and interrupts don't access event groups
-     * directly (instead they access them indirectly by pending function calls to
-     * the task level). */
-    listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+        return xSwitchRequired;
+    }
 
-    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-}
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 ) || ( configEDF_TIE_BREAK != tskEDF_TIE_KEEP_RUNNING ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TIMERS == 1 )
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_CBS == 1 ) )
 
-    void vTaskPlaceOnEventListRestricted( List_t * const pxEventList,
-                                          TickType_t xTicksToWait,
-                                          const BaseType_t xWaitIndefinitely )
+    static void prvEDFCBSWake( TCB_t * const pxTCB )
     {
-        configASSERT( pxEventList );
+        const TickType_t xTimeNow = taskEDF_TIME_NOW( taskTICK_COUNT_NOW() );
+        const uint32_t ulBudget = taskEDF_BUDGET_FROM_TICKS( pxTCB->xWCET );
+        uint32_t ulRemaining = 0UL;
 
-        /* This function should not be called by application code hence the
-         * 'Restricted' in its name.  It is not part of the public API.  It is
-         * designed for use by kernel code, and has special calling requirements -
-         * it should be called with the scheduler suspended. */
+        pxTCB->xCBSActive = pdTRUE;
 
+        if( pxTCB->ulBudgetUsed < ulBudget )
+        {
+            ulRemaining = ulBudget - pxTCB->ulBudgetUsed;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-        /* Place the event list item of the TCB in the appropriate event list.
-         * In this case it is assume that this is the only task that is going to
-         * be waiting on this event list, so the faster vListInsertEnd() function
-         * can be used in place of vListInsert. */
-        listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+        /* Keep the deadline only if the remaining budget, used up between now
+         * and the deadline, stays within the bandwidth.  That is the case if
+         * ulRemaining / ( deadline - now ) is less than xWCET / xTaskPeriod. */
+        if( ( taskEDF_TICK_IS_AFTER( pxTCB->xAbsoluteDeadline, xTimeNow ) == pdFALSE ) ||
+            ( ( ( uint64_t ) ulRemaining * ( uint64_t ) pxTCB->xTaskPeriod ) >=
+              ( ( uint64_t ) ( TickType_t ) ( pxTCB->xAbsoluteDeadline - xTimeNow ) * ( uint64_t ) ulBudget ) ) )
+        {
+            pxTCB->xReleaseTime = xTimeNow;
+            pxTCB->xAbsoluteDeadline = xTimeNow + pxTCB->xTaskPeriod;
+            pxTCB->ulBudgetUsed = 0UL;
+            pxTCB->xBudgetExhausted = pdFALSE;
 
-        /* If the task should block indefinitely then set the block time to a
-         * value that will be recognised as an indefinite delay inside the
-         * prvAddCurrentTaskToDelayedList() function. */
-        if( xWaitIndefinitely != pdFALSE )
+            #if ( configUSE_EDF_DEADLINE_MISS_DETECTION == 1 )
+                {
+                    pxTCB->xDeadlineMissed = pdFALSE;
+                }
+            #endif
+        }
+        else
         {
-            xTicksToWait = portMAX_DELAY;
+            mtCOVERAGE_TEST_MARKER();
         }
-
-        traceTASK_DELAY_UNTIL( ( xTickCount + xTicksToWait ) );
-        prvAddCurrentTaskToDelayedList( xTicksToWait, xWaitIndefinitely );
     }
-
-#endif /* configUSE_TIMERS */
 /*-----------------------------------------------------------*/
 
-BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
-{
-    TCB_t * pxUnblockedTCB;
-    BaseType_t xReturn;
+    static BaseType_t prvEDFCBSStart( TCB_t * const pxTCB,
+                                      const TickType_t xBudget,
+                                      const TickType_t xPeriod )
+    {
+        BaseType_t xYieldRequired = pdFALSE;
 
-    /* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
-     * called from a critical section within an ISR. */
+        pxTCB->xTaskPeriod = xPeriod;
+        pxTCB->xRelativeDeadline = xPeriod;
+        pxTCB->xWCET = xBudget;
+        pxTCB->xCBSServer = pdTRUE;
+        pxTCB->xCBSActive = pdFALSE;
 
-    /* The event list is sorted in priority order, so the first in the list can
-     * be removed as it is known to be the highest priority.  Remove the TCB from
-     * the delayed list, and add it to the ready list.
-     *
-     * If an event is for a queue that is locked then this function will never
-     * get called - the lock count on the queue will get modified instead.  This
-     * means exclusive access to the event list is guaranteed here.
-     *
-     * This function assumes that a check has already been made to ensure that
-     * pxEventList is not empty. */
-    pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-    configASSERT( pxUnblockedTCB );
-    listREMOVE_ITEM( &( pxUnblockedTCB->xEventListItem ) );
+        /* A deadline that has passed makes the next wake start a new server
+         * period. */
+        pxTCB->xAbsoluteDeadline = taskEDF_TIME_NOW( taskTICK_COUNT_NOW() );
 
-    if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
-    {
-        listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
-        prvAddTaskToReadyList( pxUnblockedTCB );
+        /* The task may already be Ready, in which case the server starts now,
+         * as if the task had just woken. */
+        if( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( pxTCB->xStateListItem ) ) != pdFALSE )
+        {
+            ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+            taskEDF_RESET_READY_QUEUE( pxTCB );
+            prvAddTaskToReadyList( pxTCB );
 
-        #if ( configUSE_TICKLESS_IDLE != 0 )
+            if( ( xSchedulerRunning != pdFALSE ) && ( taskEDF_GET_EARLIEST_DEADLINE_TASK() != pxCurrentTCB ) )
             {
-                /* If a task is blocked on a kernel object then xNextTaskUnblockTime
-                 * might be set to the blocked task's time out time.  If the task is
-                 * unblocked for a reason other than a timeout xNextTaskUnblockTime is
-                 * normally left unchanged, because it is automatically reset to a new
-                 * value when the tick count equals xNextTaskUnblockTime.  However if
-                 * tickless idling is used it might be more important to enter sleep mode
-                 * at the earliest possible time - so reset xNextTaskUnblockTime here to
-                 * ensure it is updated at the earliest possible time. */
-                prvResetNextTaskUnblockTime();
+                xYieldRequired = pdTRUE;
             }
-        #endif
-    }
-    else
-    {
-        /* The delayed and ready lists cannot be accessed, so hold this task
-         * pending until the scheduler is resumed. */
-        listINSERT_END( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
-    }
-
-    if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
-    {
-        /* Return true if the task removed from the event list has a higher
-         * priority than the calling task.  This allows the calling task to know if
-         * it should force a context switch now. */
-        xReturn = pdTRUE;
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            taskENTER_CRITICAL();
+            {
+                prvEDFResortEventListItem( pxTCB );
+            }
+            taskEXIT_CRITICAL();
+        }
 
-        /* Mark that a yield is pending in case the user is not using the
-         * "xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS function. */
-        xYieldPending = pdTRUE;
-    }
-    else
-    {
-        xReturn = pdFALSE;
+        return xYieldRequired;
     }
 
-    return xReturn;
-}
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_CBS == 1 ) */
 /*-----------------------------------------------------------*/
 
-void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
-                                        const TickType_t xItemValue )
-{
-    TCB_t * pxUnblockedTCB;
-
-    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
-     * the event flags implementation. */
-    configASSERT( uxSchedulerSuspended != pdFALSE );
-
-    /* Store the new item value in the event list. */
-    listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) )
 
-    /* Remove the event list form the event flag.  Interrupts do not access
-     * event flags. */
-    pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-    configASSERT( pxUnblockedTCB );
-    listREMOVE_ITEM( pxEventListItem );
+    static BaseType_t prvEDFSRPHoldBack( TCB_t * const pxTCB )
+    {
+        BaseType_t xReturn;
 
-    #if ( configUSE_TICKLESS_IDLE != 0 )
+        /* The running task and the tasks that hold a resource have started
+         * their jobs, and a job that has started is never held back. */
+        if( ( pxTCB != pxCurrentTCB ) && ( pxTCB->uxSRPResourcesHeld == ( UBaseType_t ) 0U ) )
         {
-            /* If a task is blocked on a kernel object then xNextTaskUnblockTime
-             * might be set to the blocked task's time out time.  If the task is
-             * unblocked for a reason other than a timeout xNextTaskUnblockTime is
-             * normally left unchanged, because it is automatically reset to a new
-             * value when the tick count equals xNextTaskUnblockTime.  However if
-             * tickless idling is used it might be more important to enter sleep mode
-             * at the earliest possible time - so reset xNextTaskUnblockTime here to
-             * ensure it is updated at the earliest possible time. */
-            prvResetNextTaskUnblockTime();
+            vListInsertEnd( &xEDFCeilingBlockedList, &( pxTCB->xStateListItem ) );
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
         }
-    #endif
-
-    /* Remove the task from the delayed list and add it to the ready list.  The
-     * scheduler is suspended so interrupts will not be accessing the ready
-     * lists. */
-    listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
-    prvAddTaskToReadyList( pxUnblockedTCB );
 
-    if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
-    {
-        /* The unblocked task has a priority above that of the calling task, so
-         * a context switch is required.  This function is called with the
-         * scheduler suspended so xYieldPending is set so the context switch
-         * occurs immediately that the scheduler is resumed (unsuspended). */
-        xYieldPending = pdTRUE;
+        return xReturn;
     }
-}
 /*-----------------------------------------------------------*/
 
-void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
-{
-    configASSERT( pxTimeOut );
-    taskENTER_CRITICAL();
+    static BaseType_t prvEDFSRPReleaseHeldBack( void )
     {
-        pxTimeOut->xOverflowCount = xNumOfOverflows;
-        pxTimeOut->xTimeOnEntering = xTickCount;
+        UBaseType_t uxHeldBack = listCURRENT_LIST_LENGTH( &xEDFCeilingBlockedList );
+        TCB_t * pxTCB;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        /* prvAddTaskToReadyList() holds a task back again, at the end of the
+         * list, if the ceiling is still too low for it.  Only the tasks that
+         * were held back on entry are looked at, so each is looked at once. */
+        while( uxHeldBack > ( UBaseType_t ) 0U )
+        {
+            pxTCB = listGET_OWNER_OF_HEAD_ENTRY( &xEDFCeilingBlockedList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+            ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+            prvAddTaskToReadyList( pxTCB );
+            uxHeldBack--;
+        }
+
+        if( ( xSchedulerRunning != pdFALSE ) && ( taskEDF_GET_EARLIEST_DEADLINE_TASK() != pxCurrentTCB ) )
+        {
+            xYieldRequired = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xYieldRequired;
     }
-    taskEXIT_CRITICAL();
-}
-/*-----------------------------------------------------------*/
 
-void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut )
-{
-    /* For internal use only as it does not use a critical section. */
-    pxTimeOut->xOverflowCount = xNumOfOverflows;
-    pxTimeOut->xTimeOnEntering = xTickCount;
-}
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) */
 /*-----------------------------------------------------------*/
 
-BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut,
-                                 TickType_t * const pxTicksToWait )
-{
-    BaseType_t xReturn;
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SHARED_STACK == 1 ) )
 
-    configASSERT( pxTimeOut );
-    configASSERT( pxTicksToWait );
-
-    taskENTER_CRITICAL();
+    static void prvEDFSharedStackDispatch( void )
     {
-        /* Minor optimisation.  The tick count cannot change in this block. */
-        const TickType_t xConstTickCount = xTickCount;
-        const TickType_t xElapsedTime = xConstTickCount - pxTimeOut->xTimeOnEntering;
+        StackType_t * pxTopOfStack;
 
-        #if ( INCLUDE_xTaskAbortDelay == 1 )
-            if( pxCurrentTCB->ucDelayAborted != ( uint8_t ) pdFALSE )
+        if( taskEDF_STACK_IS_SHARED( pxCurrentTCB ) != pdFALSE )
+        {
+            if( pxCurrentTCB->uxSharedStackJob == taskEDF_JOB_NOT_STARTED )
             {
-                /* The delay was aborted, which is not the same as a time out,
-                 * but has the same result. */
-                pxCurrentTCB->ucDelayAborted = pdFALSE;
-                xReturn = pdTRUE;
+                /* The job starts just below the saved context of the job on
+                 * top of the shared stack, or at the top of the stack if no
+                 * job is using it. */
+                if( pxEDFSharedStackTop == NULL )
+                {
+                    pxTopOfStack = &( xEDFSharedStack[ configEDF_SHARED_STACK_DEPTH - ( uint32_t ) 1 ] );
+                }
+                else
+                {
+                    pxTopOfStack = ( StackType_t * ) ( pxEDFSharedStackTop->pxTopOfStack ) - 1;
+                }
+
+                pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 !e9033 !e9078 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type. */
+
+                /* The shared stack is too small for this chain of
+                 * preemptions. */
+                configASSERT( pxTopOfStack > &( xEDFSharedStack[ configMINIMAL_STACK_SIZE ] ) );
+
+                #if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
+                    {
+                        pxCurrentTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, xEDFSharedStack, prvEDFSharedStackJob, pxCurrentTCB );
+                    }
+                #else
+                    {
+                        pxCurrentTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, prvEDFSharedStackJob, pxCurrentTCB );
+                    }
+                #endif
+
+                pxCurrentTCB->pxSharedStackPrevious = pxEDFSharedStackTop;
+                pxCurrentTCB->uxSharedStackJob = taskEDF_JOB_STARTED;
+                pxEDFSharedStackTop = pxCurrentTCB;
             }
             else
-        #endif
-
-        #if ( INCLUDE_vTaskSuspend == 1 )
-            if( *pxTicksToWait == portMAX_DELAY )
             {
-                /* If INCLUDE_vTaskSuspend is set to 1 and the block time
-                 * specified is the maximum block time then the task should block
-                 * indefinitely, and therefore never time out. */
-                xReturn = pdFALSE;
+                /* A job that has started can only run again once the jobs
+                 * that started after it have completed. */
+                configASSERT( pxCurrentTCB == pxEDFSharedStackTop );
             }
-            else
-        #endif
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
 
-        if( ( xNumOfOverflows != pxTimeOut->xOverflowCount ) && ( xConstTickCount >= pxTimeOut->xTimeOnEntering ) ) /*lint !e525 Indentation preferred as is to make code within pre-processor directives clearer. */
+    static void prvEDFSharedStackUnlink( TCB_t * const pxTCB )
+    {
+        TCB_t * pxAbove = NULL;
+        TCB_t * pxJob = pxEDFSharedStackTop;
+
+        while( ( pxJob != NULL ) && ( pxJob != pxTCB ) )
         {
-            /* The tick count is greater than the time at which
-             * vTaskSetTimeout() was called, but has also overflowed since
-             * vTaskSetTimeOut() was called.  It must have wrapped all the way
-             * around and gone past again. This passed since vTaskSetTimeout()
-             * was called. */
-            xReturn = pdTRUE;
-            *pxTicksToWait = ( TickType_t ) 0;
+            pxAbove = pxJob;
+            pxJob = pxJob->pxSharedStackPrevious;
+        }
+
+        configASSERT( pxJob == pxTCB );
+
+        /* The part of the stack the job used is given back with that of the
+         * job above it, or at once if it was on top. */
+        if( pxJob == NULL )
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-        else if( xElapsedTime < *pxTicksToWait ) /*lint !e961 Explicit casting is only redundant with some compilers, whereas others require it to prevent integer conversion errors. */
+        else if( pxAbove == NULL )
         {
-            /* Not a genuine timeout. Adjust parameters for time remaining. */
-            *pxTicksToWait -= xElapsedTime;
-            vTaskInternalSetTimeOutState( pxTimeOut );
-            xReturn = pdFALSE;
+            pxEDFSharedStackTop = pxTCB->pxSharedStackPrevious;
         }
         else
         {
-            *pxTicksToWait = ( TickType_t ) 0;
-            xReturn = pdTRUE;
+            pxAbove->pxSharedStackPrevious = pxTCB->pxSharedStackPrevious;
         }
-    }
-    taskEXIT_CRITICAL();
 
-    return xReturn;
-}
+        pxTCB->pxSharedStackPrevious = NULL;
+        pxTCB->uxSharedStackJob = taskEDF_JOB_NOT_STARTED;
+    }
 /*-----------------------------------------------------------*/
 
-void vTaskMissedYield( void )
-{
-    xYieldPending = pdTRUE;
-}
+    static portTASK_FUNCTION( prvEDFSharedStackJob, pvParameters )
+    {
+        TCB_t * const pxTCB = ( TCB_t * ) pvParameters;
+        TickType_t xReleaseTime;
+
+        for( ; ; )
+        {
+            pxTCB->pxJobCode( pxTCB->pvJobParameters );
+
+            /* The job has completed.  Its part of the shared stack is given
+             * back when the task blocks to wait for the next release, so it is
+             * not reused while this function still runs on it. */
+            xReleaseTime = pxTCB->xReleaseTime;
+            pxTCB->uxSharedStackJob = taskEDF_JOB_COMPLETED;
+            ( void ) xTaskDelayUntil( &xReleaseTime, pxTCB->xTaskPeriod );
+
+            /* The next job had already been released, so runs on the same part
+             * of the stack. */
+            pxTCB->uxSharedStackJob = taskEDF_JOB_STARTED;
+        }
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SHARED_STACK == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_ADMISSION_CONTROL == 1 ) )
 
-    UBaseType_t uxTaskGetTaskNumber( TaskHandle_t xTask )
+/* The processor demand h( t ) of the tasks over an interval of length
+ * ulInterval: the WCET of every job that is both released and due within
+ * it. */
+    static uint32_t prvEDFDemand( const EDFTaskParameters_t * const pxTasks,
+                                  const UBaseType_t uxTaskCount,
+                                  const uint32_t ulInterval )
     {
-        UBaseType_t uxReturn;
-        TCB_t const * pxTCB;
+        uint32_t ulDemand = 0UL;
+        UBaseType_t uxTask;
 
-        if( xTask != NULL )
+        for( uxTask = ( UBaseType_t ) 0U; uxTask < uxTaskCount; uxTask++ )
         {
-            pxTCB = xTask;
-            uxReturn = pxTCB->uxTaskNumber;
+            if( ulInterval >= ( uint32_t ) pxTasks[ uxTask ].xRelativeDeadline )
+            {
+                ulDemand += ( ( ( ulInterval - ( uint32_t ) pxTasks[ uxTask ].xRelativeDeadline ) / ( uint32_t ) pxTasks[ uxTask ].xPeriod ) + 1UL ) *
+                            ( uint32_t ) pxTasks[ uxTask ].xWCET;
+            }
         }
-        else
+
+        return ulDemand;
+    }
+/*-----------------------------------------------------------*/
+
+/* The latest absolute deadline, in the synchronous arrival pattern, that is
+ * before ulInterval.  0 if there is none. */
+    static uint32_t prvEDFDeadlineBefore( const EDFTaskParameters_t * const pxTasks,
+                                          const UBaseType_t uxTaskCount,
+                                          const uint32_t ulInterval )
+    {
+        uint32_t ulLatest = 0UL, ulDeadline;
+        UBaseType_t uxTask;
+
+        for( uxTask = ( UBaseType_t ) 0U; uxTask < uxTaskCount; uxTask++ )
         {
-            uxReturn = 0U;
+            if( ulInterval > ( uint32_t ) pxTasks[ uxTask ].xRelativeDeadline )
+            {
+                ulDeadline = ( ( ulInterval - ( uint32_t ) pxTasks[ uxTask ].xRelativeDeadline - 1UL ) / ( uint32_t ) pxTasks[ uxTask ].xPeriod ) *
+                             ( uint32_t ) pxTasks[ uxTask ].xPeriod;
+                ulDeadline += ( uint32_t ) pxTasks[ uxTask ].xRelativeDeadline;
+
+                if( ulDeadline > ulLatest )
+                {
+                    ulLatest = ulDeadline;
+                }
+            }
         }
 
-        return uxReturn;
+        return ulLatest;
     }
-
-#endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
-
-    void vTaskSetTaskNumber( TaskHandle_t xTask,
-                             const UBaseType_t uxHandle )
+/* The earliest absolute deadline, in the synchronous arrival pattern, that is
+ * after ulInterval. */
+    static uint32_t prvEDFDeadlineAfter( const EDFTaskParameters_t * const pxTasks,
+                                         const UBaseType_t uxTaskCount,
+                                         const uint32_t ulInterval )
     {
-        TCB_t * pxTCB;
+        uint32_t ulEarliest = 0xFFFFFFFFUL, ulDeadline;
+        UBaseType_t uxTask;
 
-        if( xTask != NULL )
+        for( uxTask = ( UBaseType_t ) 0U; uxTask < uxTaskCount; uxTask++ )
         {
-            pxTCB = xTask;
-            pxTCB->uxTaskNumber = uxHandle;
+            ulDeadline = ( uint32_t ) pxTasks[ uxTask ].xRelativeDeadline;
+
+            if( ulInterval >= ulDeadline )
+            {
+                ulDeadline += ( ( ( ulInterval - ulDeadline ) / ( uint32_t ) pxTasks[ uxTask ].xPeriod ) + 1UL ) * ( uint32_t ) pxTasks[ uxTask ].xPeriod;
+            }
+
+            if( ulDeadline < ulEarliest )
+            {
+                ulEarliest = ulDeadline;
+            }
         }
+
+        return ulEarliest;
     }
+/*-----------------------------------------------------------*/
 
-#endif /* configUSE_TRACE_FACILITY */
+/* Compares the total utilization of the tasks with 1, exactly.  Returns a
+ * negative value if it is below 1, 0 if it is 1 and a positive value if it is
+ * above.  The sum is kept as a fraction over the LCM of the periods seen so
+ * far.  Should that LCM no longer fit in 32 bits, the fixed point sum, which
+ * is rounded up, is used instead. */
+    static BaseType_t prvEDFCompareUtilization( const EDFTaskParameters_t * const pxTasks,
+                                                const UBaseType_t uxTaskCount,
+                                                const uint32_t ulUtilization )
+    {
+        uint64_t ullNumerator = 0ULL, ullDenominator = 1ULL, ullA, ullB, ullRemainder;
+        UBaseType_t uxTask;
+        BaseType_t xReturn = -1;
 
-/*
- * -----------------------------------------------------------
- * The Idle task.
- * ----------------------------------------------------------
- *
- * The portTASK_FUNCTION() macro is used to allow port/compiler specific
- * language extensions.  The equivalent prototype for this function is:
- *
- * void prvIdleTask( void *pvParameters );
- *
- */
-static portTASK_FUNCTION( prvIdleTask, pvParameters )
-{
-    /* Stop warnings. */
-    ( void ) pvParameters;
+        for( uxTask = ( UBaseType_t ) 0U; uxTask < uxTaskCount; uxTask++ )
+        {
+            /* Greatest common divisor of the denominator and the period. */
+            ullA = ullDenominator;
+            ullB = ( uint64_t ) pxTasks[ uxTask ].xPeriod;
 
-    /** THIS IS THE RTOS IDLE TASK - WHICH IS CREATED AUTOMATICALLY WHEN THE
-     * SCHEDULER IS STARTED. **/
+            while( ullB != 0ULL )
+            {
+                ullRemainder = ullA % ullB;
+                ullA = ullB;
+                ullB = ullRemainder;
+            }
 
-    /* In case a task that has a secure context deletes itself, in which case
-     * the idle task is responsible for deleting the task's secure context, if
-     * any. */
-    portALLOCATE_SECURE_CONTEXT( configMINIMAL_SECURE_STACK_SIZE );
+            ullB = ( uint64_t ) pxTasks[ uxTask ].xPeriod / ullA;
 
-    for( ; ; )
+            if( ( ullDenominator / ullA ) > ( 0xFFFFFFFFULL / ( uint64_t ) pxTasks[ uxTask ].xPeriod ) )
+            {
+                xReturn = ( ulUtilization > taskEDF_UTILIZATION_ONE ) ? 1 : ( ( ulUtilization == taskEDF_UTILIZATION_ONE ) ? 0 : -1 );
+                break;
+            }
+
+            /* Neither product can exceed the new denominator, which fits in
+             * 32 bits. */
+            ullNumerator = ( ullNumerator * ullB ) + ( ( uint64_t ) pxTasks[ uxTask ].xWCET * ( ullDenominator / ullA ) );
+            ullDenominator *= ullB;
+
+            if( ullNumerator > ullDenominator )
+            {
+                /* Every further term only adds to the sum. */
+                xReturn = 1;
+                break;
+            }
+
+            xReturn = ( ullNumerator == ullDenominator ) ? 0 : -1;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFDemandTest( const EDFTaskParameters_t * const pxTasks,
+                                        const UBaseType_t uxTaskCount,
+                                        uint32_t * const pulFailingInterval )
     {
-				//Updating IDLE Task Deadline to be the farest deadline
-				pxCurrentTCB->xStateListItem.xItemValue += (TickType_t)100;
-        /* See if any tasks have deleted themselves - if so then the idle task
-         * is responsible for freeing the deleted task's TCB and stack. */
-        prvCheckTasksWaitingTermination();
+        uint32_t ulUtilization = 0UL, ulDensity = 0UL, ulMinimumDeadline = 0xFFFFFFFFUL;
+        uint32_t ulBusyPeriod = 0UL, ulBound, ulInterval, ulDemand;
+        uint64_t ullSlack = 0ULL, ullNext;
+        UBaseType_t uxTask;
+        BaseType_t xReturn, xUtilization;
 
-        #if ( configUSE_PREEMPTION == 0 )
+        *pulFailingInterval = 0UL;
+
+        for( uxTask = ( UBaseType_t ) 0U; uxTask < uxTaskCount; uxTask++ )
+        {
+            ulUtilization += taskEDF_UTILIZATION( pxTasks[ uxTask ].xWCET, pxTasks[ uxTask ].xPeriod );
+            ulDensity += taskEDF_UTILIZATION( pxTasks[ uxTask ].xWCET, pxTasks[ uxTask ].xRelativeDeadline );
+            ullSlack += ( ( ( ( uint64_t ) ( pxTasks[ uxTask ].xPeriod - pxTasks[ uxTask ].xRelativeDeadline ) * ( uint64_t ) pxTasks[ uxTask ].xWCET ) << 16 ) +
+                          ( uint64_t ) pxTasks[ uxTask ].xPeriod - 1ULL ) / ( uint64_t ) pxTasks[ uxTask ].xPeriod;
+            ulBusyPeriod += ( uint32_t ) pxTasks[ uxTask ].xWCET;
+
+            if( ( uint32_t ) pxTasks[ uxTask ].xRelativeDeadline < ulMinimumDeadline )
             {
-                /* If we are not using preemption we keep forcing a task switch to
-                 * see if any other task has become available.  If we are using
-                 * preemption we don't need to do this as any task becoming available
-                 * will automatically get the processor anyway. */
-                taskYIELD();
+                ulMinimumDeadline = ( uint32_t ) pxTasks[ uxTask ].xRelativeDeadline;
+            }
+        }
+
+        xUtilization = prvEDFCompareUtilization( pxTasks, uxTaskCount, ulUtilization );
+
+        if( xUtilization > 0 )
+        {
+            /* The demand outgrows the time available in the long run, so
+             * some interval fails however the jobs line up. */
+            xReturn = pdFAIL;
+        }
+        else if( ulDensity <= taskEDF_UTILIZATION_ONE )
+        {
+            /* Sufficient on its own, and exact when every deadline equals
+             * its period.  Nothing more to do. */
+            xReturn = pdPASS;
+        }
+        else
+        {
+            /* Only intervals shorter than L = min( La, Lb ) need checking.
+             * La bounds the intervals over which the demand can still exceed
+             * the time, and only exists while the utilization is below 1.
+             * Lb is the synchronous busy period, found by iteration that
+             * stops early once it passes La.  The fixed point utilization is
+             * rounded up, which can only make La larger. */
+            if( ( xUtilization < 0 ) && ( ulUtilization < taskEDF_UTILIZATION_ONE ) )
+            {
+                ullNext = ( ullSlack + ( uint64_t ) ( taskEDF_UTILIZATION_ONE - ulUtilization ) - 1ULL ) / ( uint64_t ) ( taskEDF_UTILIZATION_ONE - ulUtilization );
+                ulBound = ( ullNext < 0xFFFFFFFFULL ) ? ( uint32_t ) ullNext : 0xFFFFFFFFUL;
+            }
+            else
+            {
+                ulBound = 0xFFFFFFFFUL;
             }
-        #endif /* configUSE_PREEMPTION */
 
-        #if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) )
+            for( ; ; )
             {
-                /* When using preemption tasks of equal priority will be
-                 * timesliced.  If a task that is sharing the idle priority is ready
-                 * to run then the idle task should yield before the end of the
-                 * timeslice.
-                 *
-                 * A critical region is not required here as we are just reading from
-                 * the list, and an occasional incorrect value will not matter.  If
-                 * the ready list at the idle priority contains more than one task
-                 * then a task other than the idle task is ready to execute. */
-                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) 1 )
+                ullNext = 0ULL;
+
+                for( uxTask = ( UBaseType_t ) 0U; uxTask < uxTaskCount; uxTask++ )
                 {
-                    taskYIELD();
+                    ullNext += ( ( ( uint64_t ) ulBusyPeriod + ( uint64_t ) pxTasks[ uxTask ].xPeriod - 1ULL ) / ( uint64_t ) pxTasks[ uxTask ].xPeriod ) *
+                               ( uint64_t ) pxTasks[ uxTask ].xWCET;
+                }
+
+                if( ullNext >= ( uint64_t ) ulBound )
+                {
+                    break;
+                }
+                else if( ullNext == ( uint64_t ) ulBusyPeriod )
+                {
+                    ulBound = ulBusyPeriod;
+                    break;
                 }
                 else
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    ulBusyPeriod = ( uint32_t ) ullNext;
                 }
             }
-        #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
 
-        #if ( configUSE_IDLE_HOOK == 1 )
+            /* QPA.  Start from the last deadline before L and step back,
+             * jumping straight to h( t ) whenever it is less than t, as no
+             * interval between the two can fail. */
+            ulInterval = prvEDFDeadlineBefore( pxTasks, uxTaskCount, ulBound );
+            ulDemand = prvEDFDemand( pxTasks, uxTaskCount, ulInterval );
+
+            while( ( ulDemand <= ulInterval ) && ( ulDemand > ulMinimumDeadline ) )
             {
-                extern void vApplicationIdleHook( void );
+                if( ulDemand < ulInterval )
+                {
+                    ulInterval = ulDemand;
+                }
+                else
+                {
+                    ulInterval = prvEDFDeadlineBefore( pxTasks, uxTaskCount, ulInterval );
+                }
 
-                /* Call the user defined function from within the idle task.  This
-                 * allows the application designer to add background functionality
-                 * without the overhead of a separate task.
-                 * NOTE: vApplicationIdleHook() MUST NOT, UNDER ANY CIRCUMSTANCES,
-                 * CALL A FUNCTION THAT MIGHT BLOCK. */
-                vApplicationIdleHook();
+                ulDemand = prvEDFDemand( pxTasks, uxTaskCount, ulInterval );
             }
-        #endif /* configUSE_IDLE_HOOK */
 
-        /* This conditional compilation should use inequality to 0, not equality
-         * to 1.  This is to ensure portSUPPRESS_TICKS_AND_SLEEP() is called when
-         * user defined low power mode  implementations require
-         * configUSE_TICKLESS_IDLE to be set to a value other than 1. */
-        #if ( configUSE_TICKLESS_IDLE != 0 )
+            if( ulDemand <= ulMinimumDeadline )
             {
-                TickType_t xExpectedIdleTime;
-
-                /* It is not desirable to suspend then resume the scheduler on
-                 * each iteration of the idle task.  Therefore, a preliminary
-                 * test of the expected idle time is performed without the
-                 * scheduler suspended.  The result here is not necessarily
-                 * valid. */
-                xExpectedIdleTime = prvGetExpectedIdleTime();
-
-                if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
-                {
-                    vTaskSuspendAll();
-                    {
-                        /* Now the scheduler is suspended, the expected idle
-                         * time can be sampled again, and this time its value can
-                         * be used. */
-                        configASSERT( xNextTaskUnblockTime >= xTickCount );
-                        xExpectedIdleTime = prvGetExpectedIdleTime();
-
-                        /* Define the following macro to set xExpectedIdleTime to 0
-                         * if the application does not want
-                         * portSUPPRESS_TICKS_AND_SLEEP() to be called. */
-                        configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( xExpectedIdleTime );
+                xReturn = pdPASS;
+            }
+            else
+            {
+                /* QPA finds a failing interval, not necessarily the first.
+                 * Walk the deadlines up from the shortest to report the first
+                 * one.  This only happens when a task is refused. */
+                ulInterval = ulMinimumDeadline;
 
-                        if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
-                        {
-                            traceLOW_POWER_IDLE_BEGIN();
-                            portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime );
-                            traceLOW_POWER_IDLE_END();
-                        }
-                        else
-                        {
-                            mtCOVERAGE_TEST_MARKER();
-                        }
-                    }
-                    ( void ) xTaskResumeAll();
-                }
-                else
+                while( prvEDFDemand( pxTasks, uxTaskCount, ulInterval ) <= ulInterval )
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    ulInterval = prvEDFDeadlineAfter( pxTasks, uxTaskCount, ulInterval );
                 }
+
+                *pulFailingInterval = ulInterval;
+                xReturn = pdFAIL;
             }
-        #endif /* configUSE_TICKLESS_IDLE */
+        }
+
+        return xReturn;
     }
-}
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TICKLESS_IDLE != 0 )
-
-    eSleepModeStatus eTaskConfirmSleepModeStatus( void )
+    static BaseType_t prvEDFAdmissionTest( const TickType_t xPeriod,
+                                           const TickType_t xRelativeDeadline,
+                                           const TickType_t xWCET,
+                                           TickType_t * const pxFailingInterval )
     {
-        /* The idle task exists in addition to the application tasks. */
-        const UBaseType_t uxNonApplicationTasks = 1;
-        eSleepModeStatus eReturn = eStandardSleep;
+        UBaseType_t uxTaskCount = uxEDFAdmittedTaskCount;
+        uint32_t ulFailingInterval = 0UL;
+        BaseType_t xReturn = pdPASS;
 
-        /* This function must be called from a critical section. */
+        if( xWCET != ( TickType_t ) 0U )
+        {
+            /* configEDF_MAX_ADMITTED_TASKS must be large enough to hold every
+             * task that declares a WCET. */
+            configASSERT( uxTaskCount < ( UBaseType_t ) configEDF_MAX_ADMITTED_TASKS );
 
-        if( listCURRENT_LIST_LENGTH( &xPendingReadyList ) != 0 )
+            if( uxTaskCount < ( UBaseType_t ) configEDF_MAX_ADMITTED_TASKS )
+            {
+                xEDFAdmittedTasks[ uxTaskCount ].xPeriod = xPeriod;
+                xEDFAdmittedTasks[ uxTaskCount ].xRelativeDeadline = xRelativeDeadline;
+                xEDFAdmittedTasks[ uxTaskCount ].xWCET = xWCET;
+                uxTaskCount++;
+            }
+            else
+            {
+                xReturn = errTASK_NOT_SCHEDULABLE;
+            }
+        }
+        else
         {
-            /* A task was made ready while the scheduler was suspended. */
-            eReturn = eAbortSleep;
+            mtCOVERAGE_TEST_MARKER();
         }
-        else if( xYieldPending != pdFALSE )
+
+        if( xReturn == pdPASS )
         {
-            /* A yield was pended while the scheduler was suspended. */
-            eReturn = eAbortSleep;
+            if( prvEDFDemandTest( xEDFAdmittedTasks, uxTaskCount, &ulFailingInterval ) != pdPASS )
+            {
+                xReturn = errTASK_NOT_SCHEDULABLE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
-        else if( xPendedTicks != 0 )
+        else
         {
-            /* A tick interrupt has already occurred but was held pending
-             * because the scheduler is suspended. */
-            eReturn = eAbortSleep;
+            mtCOVERAGE_TEST_MARKER();
         }
-        else
+
+        if( pxFailingInterval != NULL )
         {
-            /* If all the tasks are in the suspended list (which might mean they
-             * have an infinite block time rather than actually being suspended)
-             * then it is safe to turn all clocks off and just wait for external
-             * interrupts. */
-            if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == ( uxCurrentNumberOfTasks - uxNonApplicationTasks ) )
+            if( ulFailingInterval > ( uint32_t ) portMAX_DELAY )
             {
-                eReturn = eNoTasksWaitingTimeout;
+                *pxFailingInterval = portMAX_DELAY;
             }
             else
             {
-                mtCOVERAGE_TEST_MARKER();
+                *pxFailingInterval = ( TickType_t ) ulFailingInterval;
             }
         }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-        return eReturn;
+        return xReturn;
     }
-
-#endif /* configUSE_TICKLESS_IDLE */
 /*-----------------------------------------------------------*/
 
-#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
-
-    void vTaskSetThreadLocalStoragePointer( TaskHandle_t xTaskToSet,
-                                            BaseType_t xIndex,
-                                            void * pvValue )
+    static void prvEDFAdmissionRemove( const TickType_t xPeriod,
+                                       const TickType_t xRelativeDeadline,
+                                       const TickType_t xWCET )
     {
-        TCB_t * pxTCB;
+        UBaseType_t uxTask;
+        BaseType_t xFound = pdFALSE;
 
-        if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+        /* Tasks with the same parameters are interchangeable here, so any
+         * matching entry can go. */
+        for( uxTask = ( UBaseType_t ) 0U; uxTask < uxEDFAdmittedTaskCount; uxTask++ )
         {
-            pxTCB = prvGetTCBFromHandle( xTaskToSet );
-            configASSERT( pxTCB != NULL );
-            pxTCB->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
+            if( ( xEDFAdmittedTasks[ uxTask ].xPeriod == xPeriod ) &&
+                ( xEDFAdmittedTasks[ uxTask ].xRelativeDeadline == xRelativeDeadline ) &&
+                ( xEDFAdmittedTasks[ uxTask ].xWCET == xWCET ) )
+            {
+                uxEDFAdmittedTaskCount--;
+                xEDFAdmittedTasks[ uxTask ] = xEDFAdmittedTasks[ uxEDFAdmittedTaskCount ];
+                xFound = pdTRUE;
+                break;
+            }
         }
-    }
 
-#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
+        configASSERT( xFound == pdTRUE );
+        ( void ) xFound;
+    }
 /*-----------------------------------------------------------*/
 
-#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
-
-    void * pvTaskGetThreadLocalStoragePointer( TaskHandle_t xTaskToQuery,
-                                               BaseType_t xIndex )
+    static BaseType_t prvEDFAdmitNewTask( const TickType_t xPeriod,
+                                          const TickType_t xRelativeDeadline,
+                                          const TickType_t xWCET )
     {
-        void * pvReturn = NULL;
-        TCB_t * pxTCB;
+        BaseType_t xAdmitted = pdPASS;
 
-        if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+        /* The test can take a while with many tasks, so the scheduler is
+         * suspended rather than interrupts disabled. */
+        if( xWCET != ( TickType_t ) 0U )
         {
-            pxTCB = prvGetTCBFromHandle( xTaskToQuery );
-            pvReturn = pxTCB->pvThreadLocalStoragePointers[ xIndex ];
+            vTaskSuspendAll();
+            {
+                xAdmitted = prvEDFAdmissionTest( xPeriod, xRelativeDeadline, xWCET, NULL );
+
+                if( xAdmitted == pdPASS )
+                {
+                    uxEDFAdmittedTaskCount++;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            ( void ) xTaskResumeAll();
         }
         else
         {
-            pvReturn = NULL;
+            mtCOVERAGE_TEST_MARKER();
         }
 
-        return pvReturn;
-    }
-
-#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
-/*-----------------------------------------------------------*/
-
-#if ( portUSING_MPU_WRAPPERS == 1 )
-
-    void vTaskAllocateMPURegions( TaskHandle_t xTaskToModify,
-                                  const MemoryRegion_t * const xRegions )
-    {
-        TCB_t * pxTCB;
-
-        /* If null is passed in here then we are modifying the MPU settings of
-         * the calling task. */
-        pxTCB = prvGetTCBFromHandle( xTaskToModify );
-
-        vPortStoreTaskMPUSettings( &( pxTCB->xMPUSettings ), xRegions, NULL, 0 );
+        return xAdmitted;
     }
-
-#endif /* portUSING_MPU_WRAPPERS */
 /*-----------------------------------------------------------*/
 
-static void prvInitialiseTaskLists( void )
-{
-    UBaseType_t uxPriority;
-
-    for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+    static void prvEDFUnadmitNewTask( const TickType_t xPeriod,
+                                      const TickType_t xRelativeDeadline,
+                                      const TickType_t xWCET )
     {
-        vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
-    }
-		
-		/* E.C. */
-		#if ( configUSE_EDF_SCHEDULER == 1 )
-		{
-			vListInitialise( &xReadyTasksListEDF );
-		}
-		#endif
-
-    vListInitialise( &xDelayedTaskList1 );
-    vListInitialise( &xDelayedTaskList2 );
-    vListInitialise( &xPendingReadyList );
-
-    #if ( INCLUDE_vTaskDelete == 1 )
+        if( xWCET != ( TickType_t ) 0U )
         {
-            vListInitialise( &xTasksWaitingTermination );
+            vTaskSuspendAll();
+            {
+                prvEDFAdmissionRemove( xPeriod, xRelativeDeadline, xWCET );
+            }
+            ( void ) xTaskResumeAll();
         }
-    #endif /* INCLUDE_vTaskDelete */
-
-    #if ( INCLUDE_vTaskSuspend == 1 )
+        else
         {
-            vListInitialise( &xSuspendedTaskList );
+            mtCOVERAGE_TEST_MARKER();
         }
-    #endif /* INCLUDE_vTaskSuspend */
+    }
 
-    /* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
-     * using list2. */
-    pxDelayedTaskList = &xDelayedTaskList1;
-    pxOverflowDelayedTaskList = &xDelayedTaskList2;
-}
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_ADMISSION_CONTROL == 1 ) */
 /*-----------------------------------------------------------*/
 
-static void prvCheckTasksWaitingTermination( void )
-{
-    /** THIS FUNCTION IS CALLED FROM THE RTOS IDLE TASK **/
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_HEAP_READY_QUEUE == 1 ) )
 
-    #if ( INCLUDE_vTaskDelete == 1 )
+/* pdTRUE if pxA must run before pxB - that is if pxA has the earlier deadline,
+ * or the same deadline and entered the heap first.  The deadlines are compared
+ * modulo the tick range so the heap stays ordered across an overflow. */
+    #define prvEDFHeapIsBefore( pxA, pxB )                                       \
+    ( ( taskEDF_DEADLINE( pxA ) != taskEDF_DEADLINE( pxB ) ) ?                   \
+      taskEDF_TICK_IS_AFTER( taskEDF_DEADLINE( pxB ), taskEDF_DEADLINE( pxA ) ) : \
+      ( ( BaseType_t ) ( ( pxA )->uxEDFReadySequence - ( pxB )->uxEDFReadySequence ) < 0 ) )
+
+    static void prvEDFHeapSiftUp( UBaseType_t uxIndex )
+    {
+        TCB_t * const pxTCB = pxEDFReadyHeap[ uxIndex ];
+        UBaseType_t uxParent;
+
+        while( uxIndex > ( UBaseType_t ) 0U )
         {
-            TCB_t * pxTCB;
+            uxParent = ( uxIndex - ( UBaseType_t ) 1U ) >> 1;
 
-            /* uxDeletedTasksWaitingCleanUp is used to prevent taskENTER_CRITICAL()
-             * being called too often in the idle task. */
-            while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
+            if( prvEDFHeapIsBefore( pxTCB, pxEDFReadyHeap[ uxParent ] ) )
             {
-                taskENTER_CRITICAL();
-                {
-                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-                    --uxCurrentNumberOfTasks;
-                    --uxDeletedTasksWaitingCleanUp;
-                }
-                taskEXIT_CRITICAL();
-
-                prvDeleteTCB( pxTCB );
+                pxEDFReadyHeap[ uxIndex ] = pxEDFReadyHeap[ uxParent ];
+                pxEDFReadyHeap[ uxIndex ]->uxEDFHeapIndex = uxIndex;
+                uxIndex = uxParent;
+            }
+            else
+            {
+                break;
             }
         }
-    #endif /* INCLUDE_vTaskDelete */
-}
-/*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+        pxEDFReadyHeap[ uxIndex ] = pxTCB;
+        pxTCB->uxEDFHeapIndex = uxIndex;
+    }
+/*-----------------------------------------------------------*/
 
-    void vTaskGetInfo( TaskHandle_t xTask,
-                       TaskStatus_t * pxTaskStatus,
-                       BaseType_t xGetFreeStackSpace,
-                       eTaskState eState )
+    static void prvEDFHeapSiftDown( UBaseType_t uxIndex )
     {
-        TCB_t * pxTCB;
-
-        /* xTask is NULL then get the state of the calling task. */
-        pxTCB = prvGetTCBFromHandle( xTask );
+        TCB_t * const pxTCB = pxEDFReadyHeap[ uxIndex ];
+        UBaseType_t uxChild;
 
-        pxTaskStatus->xHandle = ( TaskHandle_t ) pxTCB;
-        pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName[ 0 ] );
-        pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
-        pxTaskStatus->pxStackBase = pxTCB->pxStack;
-        pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
+        for( ; ; )
+        {
+            uxChild = ( uxIndex << 1 ) + ( UBaseType_t ) 1U;
 
-        #if ( configUSE_MUTEXES == 1 )
-            {
-                pxTaskStatus->uxBasePriority = pxTCB->uxBasePriority;
-            }
-        #else
+            if( uxChild >= uxEDFHeapSize )
             {
-                pxTaskStatus->uxBasePriority = 0;
+                break;
             }
-        #endif
 
-        #if ( configGENERATE_RUN_TIME_STATS == 1 )
-            {
-                pxTaskStatus->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
-            }
-        #else
+            /* Follow the child with the earlier deadline. */
+            if( ( ( uxChild + ( UBaseType_t ) 1U ) < uxEDFHeapSize ) &&
+                prvEDFHeapIsBefore( pxEDFReadyHeap[ uxChild + ( UBaseType_t ) 1U ], pxEDFReadyHeap[ uxChild ] ) )
             {
-                pxTaskStatus->ulRunTimeCounter = ( configRUN_TIME_COUNTER_TYPE ) 0;
+                uxChild++;
             }
-        #endif
 
-        /* Obtaining the task state is a little fiddly, so is only done if the
-         * value of eState passed into this function is eInvalid - otherwise the
-         * state is just set to whatever is passed in. */
-        if( eState != eInvalid )
-        {
-            if( pxTCB == pxCurrentTCB )
+            if( prvEDFHeapIsBefore( pxEDFReadyHeap[ uxChild ], pxTCB ) )
             {
-                pxTaskStatus->eCurrentState = eRunning;
+                pxEDFReadyHeap[ uxIndex ] = pxEDFReadyHeap[ uxChild ];
+                pxEDFReadyHeap[ uxIndex ]->uxEDFHeapIndex = uxIndex;
+                uxIndex = uxChild;
             }
             else
             {
-                pxTaskStatus->eCurrentState = eState;
-
-                #if ( INCLUDE_vTaskSuspend == 1 )
-                    {
-                        /* If the task is in the suspended list then there is a
-                         *  chance it is actually just blocked indefinitely - so really
-                         *  it should be reported as being in the Blocked state. */
-                        if( eState == eSuspended )
-                        {
-                            vTaskSuspendAll();
-                            {
-                                if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-                                {
-                                    pxTaskStatus->eCurrentState = eBlocked;
-                                }
-                            }
-                            ( void ) xTaskResumeAll();
-                        }
-                    }
-                #endif /* INCLUDE_vTaskSuspend */
+                break;
             }
         }
+
+        pxEDFReadyHeap[ uxIndex ] = pxTCB;
+        pxTCB->uxEDFHeapIndex = uxIndex;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFHeapInsert( TCB_t * pxTCB )
+    {
+        /* configEDF_MAX_READY_TASKS must be large enough to hold every task
+         * that can be in the Ready state at the same time. */
+        configASSERT( uxEDFHeapSize < ( UBaseType_t ) configEDF_MAX_READY_TASKS );
+        configASSERT( pxTCB->uxEDFHeapIndex == taskEDF_HEAP_INDEX_NONE );
+
+        pxTCB->uxEDFReadySequence = uxEDFReadySequence;
+        uxEDFReadySequence++;
+
+        pxEDFReadyHeap[ uxEDFHeapSize ] = pxTCB;
+        uxEDFHeapSize++;
+        prvEDFHeapSiftUp( uxEDFHeapSize - ( UBaseType_t ) 1U );
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFHeapRemove( TCB_t * pxTCB )
+    {
+        const UBaseType_t uxIndex = pxTCB->uxEDFHeapIndex;
+        TCB_t * pxLast;
+
+        configASSERT( uxIndex < uxEDFHeapSize );
+
+        uxEDFHeapSize--;
+        pxTCB->uxEDFHeapIndex = taskEDF_HEAP_INDEX_NONE;
+
+        if( uxIndex != uxEDFHeapSize )
+        {
+            /* Fill the hole with the last entry, which can then need to move
+             * either up or down from there. */
+            pxLast = pxEDFReadyHeap[ uxEDFHeapSize ];
+            pxEDFReadyHeap[ uxIndex ] = pxLast;
+            pxLast->uxEDFHeapIndex = uxIndex;
+            prvEDFHeapSiftUp( uxIndex );
+            prvEDFHeapSiftDown( pxLast->uxEDFHeapIndex );
+        }
         else
         {
-            pxTaskStatus->eCurrentState = eTaskGetState( pxTCB );
+            mtCOVERAGE_TEST_MARKER();
         }
+    }
 
-        /* Obtaining the stack space takes some time, so the xGetFreeStackSpace
-         * parameter is provided to allow it to be skipped. */
-        if( xGetFreeStackSpace != pdFALSE )
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_HEAP_READY_QUEUE == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BUCKET_READY_QUEUE == 1 ) )
+
+    static void prvEDFBucketLink( UBaseType_t uxBucket,
+                                  TCB_t * pxTCB,
+                                  TCB_t * pxNext )
+    {
+        TCB_t * const pxFirst = pxEDFBuckets[ uxBucket ];
+
+        /* Link pxTCB in front of pxNext, or at the end of the bucket if pxNext
+         * is NULL. */
+        if( pxFirst == NULL )
         {
-            #if ( portSTACK_GROWTH > 0 )
-                {
-                    pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
-                }
-            #else
-                {
-                    pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
-                }
-            #endif
+            pxTCB->pxEDFBucketNext = pxTCB;
+            pxTCB->pxEDFBucketPrevious = pxTCB;
+            pxEDFBuckets[ uxBucket ] = pxTCB;
         }
         else
         {
-            pxTaskStatus->usStackHighWaterMark = 0;
+            if( pxNext == NULL )
+            {
+                pxNext = pxFirst;
+            }
+            else if( pxNext == pxFirst )
+            {
+                pxEDFBuckets[ uxBucket ] = pxTCB;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxTCB->pxEDFBucketNext = pxNext;
+            pxTCB->pxEDFBucketPrevious = pxNext->pxEDFBucketPrevious;
+            pxNext->pxEDFBucketPrevious->pxEDFBucketNext = pxTCB;
+            pxNext->pxEDFBucketPrevious = pxTCB;
         }
-    }
 
-#endif /* configUSE_TRACE_FACILITY */
+        pxTCB->uxEDFBucket = uxBucket;
+    }
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
-
-    static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t * pxTaskStatusArray,
-                                                     List_t * pxList,
-                                                     eTaskState eState )
+    static void prvEDFBucketLinkSorted( UBaseType_t uxBucket,
+                                        TCB_t * pxTCB )
     {
-        configLIST_VOLATILE TCB_t * pxNextTCB, * pxFirstTCB;
-        UBaseType_t uxTask = 0;
+        TCB_t * const pxFirst = pxEDFBuckets[ uxBucket ];
+        TCB_t * pxNext = pxFirst;
 
-        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+        /* Only the late and overflow lists are sorted.  They are normally
+         * empty, or very short, so a linear search is used.  Tasks with equal
+         * deadlines stay in FIFO order. */
+        if( pxNext != NULL )
         {
-            listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-
-            /* Populate an TaskStatus_t structure within the
-             * pxTaskStatusArray array for each task that is referenced from
-             * pxList.  See the definition of TaskStatus_t in task.h for the
-             * meaning of each TaskStatus_t structure member. */
             do
             {
-                listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-                vTaskGetInfo( ( TaskHandle_t ) pxNextTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eState );
-                uxTask++;
-            } while( pxNextTCB != pxFirstTCB );
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
+                if( taskEDF_TICK_IS_AFTER( taskEDF_DEADLINE( pxNext ), taskEDF_DEADLINE( pxTCB ) ) )
+                {
+                    break;
+                }
+
+                pxNext = pxNext->pxEDFBucketNext;
+            } while( pxNext != pxFirst );
+
+            if( ( pxNext == pxFirst ) && !taskEDF_TICK_IS_AFTER( taskEDF_DEADLINE( pxFirst ), taskEDF_DEADLINE( pxTCB ) ) )
+            {
+                pxNext = NULL;
+            }
         }
 
-        return uxTask;
+        prvEDFBucketLink( uxBucket, pxTCB, pxNext );
     }
-
-#endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
-
-    static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
+    static void prvEDFBucketInsert( TCB_t * pxTCB )
     {
-        uint32_t ulCount = 0U;
+        const TickType_t xOffset = taskEDF_DEADLINE( pxTCB ) - xEDFBucketBase;
+        UBaseType_t uxBucket;
 
-        while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
+        configASSERT( pxTCB->uxEDFBucket == taskEDF_BUCKET_NONE );
+
+        if( xOffset < ( TickType_t ) configEDF_BUCKET_COUNT )
         {
-            pucStackByte -= portSTACK_GROWTH;
-            ulCount++;
+            uxBucket = ( UBaseType_t ) ( taskEDF_DEADLINE( pxTCB ) & taskEDF_BUCKET_MASK );
+            prvEDFBucketLink( uxBucket, pxTCB, NULL );
+            ulEDFBucketMap[ uxBucket >> 5 ] |= 1UL << ( uxBucket & 31U );
+            ulEDFBucketMapSummary |= 1UL << ( uxBucket >> 5 );
+        }
+        else if( taskEDF_TICK_IS_AFTER( xEDFBucketBase, taskEDF_DEADLINE( pxTCB ) ) )
+        {
+            prvEDFBucketLinkSorted( taskEDF_BUCKET_LATE, pxTCB );
+        }
+        else
+        {
+            prvEDFBucketLinkSorted( taskEDF_BUCKET_OVERFLOW, pxTCB );
         }
-
-        ulCount /= ( uint32_t ) sizeof( StackType_t ); /*lint !e961 Casting is not redundant on smaller architectures. */
-
-        return ( configSTACK_DEPTH_TYPE ) ulCount;
     }
-
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
-
-/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are the
- * same except for their return type.  Using configSTACK_DEPTH_TYPE allows the
- * user to determine the return type.  It gets around the problem of the value
- * overflowing on 8-bit types without breaking backward compatibility for
- * applications that expect an 8-bit return type. */
-    configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask )
+    static void prvEDFBucketRemove( TCB_t * pxTCB )
     {
-        TCB_t * pxTCB;
-        uint8_t * pucEndOfStack;
-        configSTACK_DEPTH_TYPE uxReturn;
+        const UBaseType_t uxBucket = pxTCB->uxEDFBucket;
 
-        /* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are
-         * the same except for their return type.  Using configSTACK_DEPTH_TYPE
-         * allows the user to determine the return type.  It gets around the
-         * problem of the value overflowing on 8-bit types without breaking
-         * backward compatibility for applications that expect an 8-bit return
-         * type. */
+        configASSERT( uxBucket <= taskEDF_BUCKET_OVERFLOW );
 
-        pxTCB = prvGetTCBFromHandle( xTask );
+        if( pxTCB->pxEDFBucketNext == pxTCB )
+        {
+            pxEDFBuckets[ uxBucket ] = NULL;
 
-        #if portSTACK_GROWTH < 0
+            if( uxBucket < taskEDF_BUCKET_LATE )
             {
-                pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+                ulEDFBucketMap[ uxBucket >> 5 ] &= ~( 1UL << ( uxBucket & 31U ) );
+
+                if( ulEDFBucketMap[ uxBucket >> 5 ] == 0UL )
+                {
+                    ulEDFBucketMapSummary &= ~( 1UL << ( uxBucket >> 5 ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
-        #else
+            else
             {
-                pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+                mtCOVERAGE_TEST_MARKER();
             }
-        #endif
+        }
+        else
+        {
+            pxTCB->pxEDFBucketPrevious->pxEDFBucketNext = pxTCB->pxEDFBucketNext;
+            pxTCB->pxEDFBucketNext->pxEDFBucketPrevious = pxTCB->pxEDFBucketPrevious;
 
-        uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
+            if( pxEDFBuckets[ uxBucket ] == pxTCB )
+            {
+                pxEDFBuckets[ uxBucket ] = pxTCB->pxEDFBucketNext;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
 
-        return uxReturn;
+        pxTCB->uxEDFBucket = taskEDF_BUCKET_NONE;
     }
-
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark2 */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
-
-    UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
+    static TCB_t * prvEDFBucketGetFirst( void )
     {
-        TCB_t * pxTCB;
-        uint8_t * pucEndOfStack;
-        UBaseType_t uxReturn;
+        const UBaseType_t uxBase = ( UBaseType_t ) ( xEDFBucketBase & taskEDF_BUCKET_MASK );
+        const UBaseType_t uxWord = uxBase >> 5;
+        uint32_t ulBits;
+        UBaseType_t uxFound;
 
-        pxTCB = prvGetTCBFromHandle( xTask );
+        /* Deadlines that have already passed the window start come first. */
+        if( pxEDFBuckets[ taskEDF_BUCKET_LATE ] != NULL )
+        {
+            return pxEDFBuckets[ taskEDF_BUCKET_LATE ];
+        }
 
-        #if portSTACK_GROWTH < 0
+        if( ulEDFBucketMapSummary == 0UL )
+        {
+            if( pxEDFBuckets[ taskEDF_BUCKET_OVERFLOW ] != NULL )
             {
-                pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+                return pxEDFBuckets[ taskEDF_BUCKET_OVERFLOW ];
             }
-        #else
+
+            /* No task is in the Ready state. */
+            return ( TCB_t * ) xIdleTaskHandle;
+        }
+
+        /* The window is circular and starts at uxBase.  First look in the
+         * bitmap word holding uxBase, from uxBase up. */
+        ulBits = ulEDFBucketMap[ uxWord ] & ( 0xFFFFFFFFUL << ( uxBase & 31U ) );
+
+        if( ulBits != 0UL )
+        {
+            uxFound = ( uxWord << 5 ) + taskFIND_FIRST_SET( ulBits );
+        }
+        else
+        {
+            /* Then in the words after it.  If there are none, wrap around.
+             * The bits of uxWord at or above uxBase are known to be clear, so
+             * the lowest set bit left is the next bucket in window order. */
+            ulBits = ulEDFBucketMapSummary & ( 0xFFFFFFFEUL << uxWord );
+
+            if( ulBits == 0UL )
             {
-                pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+                ulBits = ulEDFBucketMapSummary;
             }
-        #endif
 
-        uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
+            uxFound = taskFIND_FIRST_SET( ulBits );
+            uxFound = ( uxFound << 5 ) + taskFIND_FIRST_SET( ulEDFBucketMap[ uxFound ] );
+        }
 
-        return uxReturn;
+        return pxEDFBuckets[ uxFound ];
     }
-
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelete == 1 )
-
-    static void prvDeleteTCB( TCB_t * pxTCB )
+    static void prvEDFBucketAdvance( const TickType_t xTickNow )
     {
-        /* This call is required specifically for the TriCore port.  It must be
-         * above the vPortFree() calls.  The call is also used by ports/demos that
-         * want to allocate and clean RAM statically. */
-        portCLEAN_UP_TCB( pxTCB );
+        UBaseType_t uxBucket;
+        TCB_t * pxTCB;
 
-        /* Free up the memory allocated by the scheduler for the task.  It is up
-         * to the task to free any memory allocated at the application level.
-         * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
-         * for additional information. */
-        #if ( configUSE_NEWLIB_REENTRANT == 1 )
+        while( xEDFBucketBase != xTickNow )
+        {
+            if( ( ulEDFBucketMapSummary == 0UL ) && ( pxEDFBuckets[ taskEDF_BUCKET_OVERFLOW ] == NULL ) )
             {
-                _reclaim_reent( &( pxTCB->xNewLib_reent ) );
+                /* Nothing to move, so the window can jump straight there. */
+                xEDFBucketBase = xTickNow;
+                break;
             }
-        #endif /* configUSE_NEWLIB_REENTRANT */
 
-        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
+            /* The bucket at the window start is about to leave the window.
+             * Its tasks all have the deadline xEDFBucketBase, which is later
+             * than that of any task already late, so they are appended. */
+            uxBucket = ( UBaseType_t ) ( xEDFBucketBase & taskEDF_BUCKET_MASK );
+
+            while( pxEDFBuckets[ uxBucket ] != NULL )
             {
-                /* The task can only have been allocated dynamically - free both
-                 * the stack and TCB. */
-                vPortFreeStack( pxTCB->pxStack );
-                vPortFree( pxTCB );
+                pxTCB = pxEDFBuckets[ uxBucket ];
+                prvEDFBucketRemove( pxTCB );
+                prvEDFBucketLink( taskEDF_BUCKET_LATE, pxTCB, NULL );
             }
-        #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
+
+            xEDFBucketBase++;
+
+            /* The slot that was just freed now stands for the deadline
+             * xEDFBucketBase + configEDF_BUCKET_COUNT - 1, so the first
+             * overflow task can have come into the window. */
+            while( pxEDFBuckets[ taskEDF_BUCKET_OVERFLOW ] != NULL )
             {
-                /* The task could have been allocated statically or dynamically, so
-                 * check what was statically allocated before trying to free the
-                 * memory. */
-                if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
-                {
-                    /* Both the stack and TCB were allocated dynamically, so both
-                     * must be freed. */
-                    vPortFreeStack( pxTCB->pxStack );
-                    vPortFree( pxTCB );
-                }
-                else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
-                {
-                    /* Only the stack was statically allocated, so the TCB is the
-                     * only memory that must be freed. */
-                    vPortFree( pxTCB );
-                }
-                else
+                pxTCB = pxEDFBuckets[ taskEDF_BUCKET_OVERFLOW ];
+
+                if( ( taskEDF_DEADLINE( pxTCB ) - xEDFBucketBase ) >= ( TickType_t ) configEDF_BUCKET_COUNT )
                 {
-                    /* Neither the stack nor the TCB were allocated dynamically, so
-                     * nothing needs to be freed. */
-                    configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
-                    mtCOVERAGE_TEST_MARKER();
+                    break;
                 }
+
+                prvEDFBucketRemove( pxTCB );
+                prvEDFBucketInsert( pxTCB );
             }
-        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+        }
     }
 
-#endif /* INCLUDE_vTaskDelete */
-/*-----------------------------------------------------------*/
-
-static void prvResetNextTaskUnblockTime( void )
-{
-    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
-    {
-        /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
-         * the maximum possible value so it is  extremely unlikely that the
-         * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
-         * there is an item in the delayed list. */
-        xNextTaskUnblockTime = portMAX_DELAY;
-    }
-    else
-    {
-        /* The new current delayed list is not empty, get the value of
-         * the item at the head of the delayed list.  This is the time at
-         * which the task at the head of the delayed list should be removed
-         * from the Blocked state. */
-        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
-    }
-}
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BUCKET_READY_QUEUE == 1 ) */
 /*-----------------------------------------------------------*/
 
 #if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
@@ -4265,6 +8805,53 @@ static void prvResetNextTaskUnblockTime( void )
          * needed as interrupts can no longer use mutexes? */
         if( pxMutexHolder != NULL )
         {
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DEADLINE_INHERITANCE == 1 ) )
+                {
+                    /* If the mutex holder is scheduled on a later deadline than
+                     * the task attempting to obtain the mutex then it will
+                     * temporarily inherit the deadline of that task. */
+                    if( taskEDF_TICK_IS_AFTER( taskEDF_DEADLINE( pxMutexHolderTCB ), taskEDF_DEADLINE( pxCurrentTCB ) ) )
+                    {
+                        /* If the task being modified is in the ready state it
+                         * will need to be moved to its new place in the ready
+                         * queue. */
+                        if( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( pxMutexHolderTCB->xStateListItem ) ) != pdFALSE )
+                        {
+                            ( void ) uxListRemove( &( pxMutexHolderTCB->xStateListItem ) );
+                            taskEDF_RESET_READY_QUEUE( pxMutexHolderTCB );
+
+                            /* Inherit the deadline before being queued again. */
+                            pxMutexHolderTCB->xInheritedDeadline = taskEDF_DEADLINE( pxCurrentTCB );
+                            pxMutexHolderTCB->xDeadlineInherited = pdTRUE;
+                            prvAddTaskToReadyList( pxMutexHolderTCB );
+                        }
+                        else
+                        {
+                            /* Just inherit the deadline.  The holder may be
+                             * waiting for another mutex, in which case it moves
+                             * forward in the list of tasks waiting for it. */
+                            pxMutexHolderTCB->xInheritedDeadline = taskEDF_DEADLINE( pxCurrentTCB );
+                            pxMutexHolderTCB->xDeadlineInherited = pdTRUE;
+                            prvEDFResortEventListItem( pxMutexHolderTCB );
+                        }
+
+                        /* Inheritance occurred. */
+                        xReturn = pdTRUE;
+                    }
+                    else if( pxMutexHolderTCB->xDeadlineInherited != pdFALSE )
+                    {
+                        /* The mutex holder already runs on a deadline it
+                         * inherited, which is not later than the deadline of
+                         * the task attempting to take the mutex. */
+                        xReturn = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DEADLINE_INHERITANCE == 1 ) */
+
             /* If the holder of the mutex has a priority below the priority of
              * the task attempting to obtain the mutex then it will temporarily
              * inherit the priority of the task attempting to obtain the mutex. */
@@ -4273,7 +8860,7 @@ static void prvResetNextTaskUnblockTime( void )
                 /* Adjust the mutex holder state to account for its new
                  * priority.  Only reset the event list item value if the value is
                  * not being used for anything else. */
-                if( ( listGET_LIST_ITEM_VALUE( &( pxMutexHolderTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+                if( taskEVENT_LIST_ITEM_VALUE_IS_PRIORITY( pxMutexHolderTCB ) )
                 {
                     listSET_LIST_ITEM_VALUE( &( pxMutexHolderTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
                 }
@@ -4381,6 +8968,8 @@ static void prvResetNextTaskUnblockTime( void )
                         mtCOVERAGE_TEST_MARKER();
                     }
 
+                    taskEDF_RESET_READY_QUEUE( pxTCB );
+
                     /* Disinherit the priority before adding the task into the
                      * new  ready list. */
                     traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
@@ -4411,6 +9000,29 @@ static void prvResetNextTaskUnblockTime( void )
             {
                 mtCOVERAGE_TEST_MARKER();
             }
+
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DEADLINE_INHERITANCE == 1 ) )
+                {
+                    /* As with priorities, an inherited deadline is only given
+                     * back once no other mutexes are held.  The task is running,
+                     * so is in the ready queue. */
+                    if( ( pxTCB->xDeadlineInherited != pdFALSE ) && ( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 ) )
+                    {
+                        ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                        taskEDF_RESET_READY_QUEUE( pxTCB );
+                        pxTCB->xDeadlineInherited = pdFALSE;
+                        prvAddTaskToReadyList( pxTCB );
+
+                        /* A task with a deadline between the two may now be
+                         * the earliest. */
+                        xReturn = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DEADLINE_INHERITANCE == 1 ) */
         }
         else
         {
@@ -4432,6 +9044,16 @@ static void prvResetNextTaskUnblockTime( void )
         UBaseType_t uxPriorityUsedOnEntry, uxPriorityToUse;
         const UBaseType_t uxOnlyOneMutexHeld = ( UBaseType_t ) 1;
 
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                /* queue.c works this out from the event list item value of the
+                 * first task waiting for the mutex, which under EDF is a
+                 * deadline rather than a priority.  Priorities do not order EDF
+                 * tasks, so only the base priority is restored. */
+                uxHighestPriorityWaitingTask = tskIDLE_PRIORITY;
+            }
+        #endif
+
         if( pxMutexHolder != NULL )
         {
             /* If pxMutexHolder is not NULL then the holder must hold at least
@@ -4474,7 +9096,7 @@ static void prvResetNextTaskUnblockTime( void )
 
                     /* Only reset the event list item value if the value is not
                      * being used for anything else. */
-                    if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+                    if( taskEVENT_LIST_ITEM_VALUE_IS_PRIORITY( pxTCB ) )
                     {
                         listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriorityToUse ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
                     }
@@ -5140,7 +9762,7 @@ TickType_t uxTaskResetEventItemValue( void )
                     }
                 #endif
 
-                if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                if( taskWOKEN_TASK_PREEMPTS( pxTCB, ( pxTCB->uxPriority > pxCurrentTCB->uxPriority ) ) != pdFALSE )
                 {
                     /* The notified task has a priority above the currently
                      * executing task so a yield is required. */
@@ -5266,7 +9888,7 @@ TickType_t uxTaskResetEventItemValue( void )
                 if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
                 {
                     listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
+                    prvAddWokenTaskToReadyList( pxTCB );
                 }
                 else
                 {
@@ -5275,7 +9897,7 @@ TickType_t uxTaskResetEventItemValue( void )
                     listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
                 }
 
-                if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                if( taskWOKEN_TASK_PREEMPTS( pxTCB, ( pxTCB->uxPriority > pxCurrentTCB->uxPriority ) ) != pdFALSE )
                 {
                     /* The notified task has a priority above the currently
                      * executing task so a yield is required. */
@@ -5357,7 +9979,7 @@ TickType_t uxTaskResetEventItemValue( void )
                 if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
                 {
                     listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
+                    prvAddWokenTaskToReadyList( pxTCB );
                 }
                 else
                 {
@@ -5366,7 +9988,7 @@ TickType_t uxTaskResetEventItemValue( void )
                     listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
                 }
 
-                if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                if( taskWOKEN_TASK_PREEMPTS( pxTCB, ( pxTCB->uxPriority > pxCurrentTCB->uxPriority ) ) != pdFALSE )
                 {
                     /* The notified task has a priority above the currently
                      * executing task so a yield is required. */
@@ -5519,6 +10141,34 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
         mtCOVERAGE_TEST_MARKER();
     }
 
+    taskEDF_RESET_READY_QUEUE( pxCurrentTCB );
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_CBS == 1 ) )
+        {
+            /* A server whose task blocks goes idle until the task wakes. */
+            pxCurrentTCB->xCBSActive = pdFALSE;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SHARED_STACK == 1 ) )
+        {
+            /* A completed job gives its part of the shared stack back once
+             * its task has stopped using it, which is now.  Only the job on
+             * top of the shared stack can have completed. */
+            if( pxCurrentTCB->uxSharedStackJob == taskEDF_JOB_COMPLETED )
+            {
+                configASSERT( pxCurrentTCB == pxEDFSharedStackTop );
+                pxEDFSharedStackTop = pxCurrentTCB->pxSharedStackPrevious;
+                pxCurrentTCB->pxSharedStackPrevious = NULL;
+                pxCurrentTCB->uxSharedStackJob = taskEDF_JOB_NOT_STARTED;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif
+
     #if ( INCLUDE_vTaskSuspend == 1 )
         {
             if( ( xTicksToWait == portMAX_DELAY ) && ( xCanBlockIndefinitely != pdFALSE ) )
@@ -5533,11 +10183,18 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
                 /* Calculate the time at which the task should be woken if the event
                  * does not occur.  This may overflow but this doesn't matter, the
                  * kernel will manage it correctly. */
-                xTimeToWake = xConstTickCount + xTicksToWait;
+                xTimeToWake = xConstTickCount + taskTICKS_NOT_COUNTED() + xTicksToWait;
 
                 /* The list item will be inserted in wake time order. */
                 listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
+                #if ( configUSE_TIMING_WHEEL == 1 )
+                    if( taskTIMING_WHEEL_HOLDS( xTimeToWake - xConstTickCount ) != pdFALSE )
+                    {
+                        prvTimingWheelInsert( &( pxCurrentTCB->xStateListItem ) );
+                    }
+                    else
+                #endif
                 if( xTimeToWake < xConstTickCount )
                 {
                     /* Wake time has overflowed.  Place this item in the overflow
@@ -5569,11 +10226,18 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
             /* Calculate the time at which the task should be woken if the event
              * does not occur.  This may overflow but this doesn't matter, the kernel
              * will manage it correctly. */
-            xTimeToWake = xConstTickCount + xTicksToWait;
+            xTimeToWake = xConstTickCount + taskTICKS_NOT_COUNTED() + xTicksToWait;
 
             /* The list item will be inserted in wake time order. */
             listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
+            #if ( configUSE_TIMING_WHEEL == 1 )
+                if( taskTIMING_WHEEL_HOLDS( xTimeToWake - xConstTickCount ) != pdFALSE )
+                {
+                    prvTimingWheelInsert( &( pxCurrentTCB->xStateListItem ) );
+                }
+                else
+            #endif
             if( xTimeToWake < xConstTickCount )
             {
                 /* Wake time has overflowed.  Place this item in the overflow list. */
@@ -0,0 +1,49 @@
+# Src/task.c compiled on its own in each configuration below, with every
+# warning an error, so that no combination of the options leaves a function or
+# a variable unused.  Each configuration changes the demo's
+# Src/FreeRTOSConfig.h in a few options.
+CONFIG_MATRIX := demo edf_off heap bucket no_admission no_miss_detection \
+                 no_budget cbs_off demote srp srp_no_budget srp_event_tick \
+                 inheritance mutexes shared_stack shared_stack_notify \
+                 fine_time event_tick no_timing_wheel tickless fifo \
+                 round_robin isr_release_queue job_records
+CONFIG_MATRIX_demo                :=
+CONFIG_MATRIX_edf_off             := configUSE_EDF_SCHEDULER=0
+CONFIG_MATRIX_heap                := configUSE_EDF_HEAP_READY_QUEUE=1
+CONFIG_MATRIX_bucket              := configUSE_EDF_BUCKET_READY_QUEUE=1
+CONFIG_MATRIX_no_admission        := configUSE_EDF_ADMISSION_CONTROL=0
+CONFIG_MATRIX_no_miss_detection   := configUSE_EDF_DEADLINE_MISS_DETECTION=0
+CONFIG_MATRIX_no_budget           := configUSE_EDF_BUDGET_ENFORCEMENT=0 configUSE_EDF_CBS=0
+CONFIG_MATRIX_cbs_off             := configUSE_EDF_CBS=0
+CONFIG_MATRIX_demote              := configEDF_BUDGET_OVERRUN_ACTION=tskEDF_BUDGET_DEMOTE
+CONFIG_MATRIX_srp                 := configUSE_EDF_SRP=1
+CONFIG_MATRIX_srp_no_budget       := configUSE_EDF_SRP=1 configUSE_EDF_BUDGET_ENFORCEMENT=0 configUSE_EDF_CBS=0
+CONFIG_MATRIX_srp_event_tick      := configUSE_EDF_SRP=1 configUSE_EDF_EVENT_TICK=1
+CONFIG_MATRIX_inheritance         := configUSE_EDF_CBS=0 configUSE_MUTEXES=1 configUSE_EDF_DEADLINE_INHERITANCE=1
+CONFIG_MATRIX_mutexes             := configUSE_MUTEXES=1
+CONFIG_MATRIX_shared_stack        := configUSE_EDF_SHARED_STACK=1
+CONFIG_MATRIX_shared_stack_notify := configUSE_EDF_SHARED_STACK=1 configEDF_BUDGET_OVERRUN_ACTION=tskEDF_BUDGET_NOTIFY
+CONFIG_MATRIX_fine_time           := configUSE_EDF_FINE_TIME=1
+CONFIG_MATRIX_event_tick          := configUSE_EDF_EVENT_TICK=1
+CONFIG_MATRIX_no_timing_wheel     := configUSE_TIMING_WHEEL=0
+CONFIG_MATRIX_tickless            := configUSE_TICKLESS_IDLE=1
+CONFIG_MATRIX_fifo                := configEDF_TIE_BREAK=tskEDF_TIE_FIFO
+CONFIG_MATRIX_round_robin         := configEDF_TIE_BREAK=tskEDF_TIE_ROUND_ROBIN
+CONFIG_MATRIX_isr_release_queue   := configUSE_EDF_ISR_RELEASE_QUEUE=1
+CONFIG_MATRIX_job_records         := configUSE_EDF_JOB_RECORDS=1
+
+# $(call config_matrix,name)
+define config_matrix
+$(BUILD)/config_$(1)/FreeRTOSConfig.h: $(HEADERS) $(MAKEFILE_LIST)
+	@mkdir -p $$(@D)
+	@sh port/mkconfig.sh $$@ $(CONFIG_MATRIX_$(1))
+
+$(BUILD)/config_$(1)/task.o: ../Src/task.c $(BUILD)/config_$(1)/FreeRTOSConfig.h
+	$(CC) $(CFLAGS) -Werror -DFREERTOS_MODULE_TEST -I$(BUILD)/config_$(1) -Iport -c -o $$@ ../Src/task.c
+endef
+$(foreach c,$(CONFIG_MATRIX),$(eval $(call config_matrix,$(c))))
+
+.PHONY: check_config_matrix
+check_config_matrix: $(foreach c,$(CONFIG_MATRIX),$(BUILD)/config_$(c)/task.o)
+
+CHECKS += check_config_matrix
@@ -0,0 +1,200 @@
+/*
+ * Runs the same task set with the event tick (configUSE_EDF_EVENT_TICK) and
+ * with the periodic tick, to compare how many scheduler interrupts each takes.
+ * The tasks have periods of 10, 20, 50 and 100 ticks.
+ *
+ * Time is kept by T1TC, the counter portEDF_GET_BUDGET_COUNTER() reads in
+ * Src/FreeRTOSConfig.h, at configEDF_BUDGET_COUNTS_PER_TICK counts to a tick.
+ * It is advanced 10 counts a step, and the running task's job uses those 10
+ * counts of its execution time.  The periodic build calls xTaskIncrementTick()
+ * each time the counter crosses a tick.  The event build calls
+ * xTaskEDFEventTick() when the counter reaches the value last passed to
+ * portEDF_SET_COMPARE(), which the host port records.
+ *
+ * Each job must start on a tick and finish by its deadline, and each task
+ * must be released at the start of every period.  The program prints the
+ * interrupt count and a hash of the schedule; 'make check' requires the hash
+ * to be the same for both builds, and the event build to take at most a fifth
+ * of the interrupts.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "host_port.h"
+
+#define testTASKS             4
+#define testSTEP_COUNTS       10UL
+#define testSTEPS             60000
+
+#if ( configUSE_EDF_EVENT_TICK == 1 )
+    #define testTICK    "event"
+#else
+    #define testTICK    "periodic"
+#endif
+
+typedef struct
+{
+    const char * pcName;
+    TickType_t xPeriod;
+    unsigned long ulWorkCounts;
+    TaskHandle_t xHandle;
+    TickType_t xLastRelease;
+    unsigned long ulWorkLeft;
+    int iJobs;
+} TestTask_t;
+
+/* Utilization 0.66.  The declared WCETs are a tick longer than the work, so
+ * the budgets never run out. */
+static TestTask_t xTestTasks[ testTASKS ] =
+{
+    { "A", 10,  120 },
+    { "B", 20,  180 },
+    { "C", 50,  600 },
+    { "D", 100, 900 }
+};
+
+static void prvTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+}
+/*-----------------------------------------------------------*/
+
+static TestTask_t * prvRunning( void )
+{
+    TaskHandle_t xRunning = xTaskGetCurrentTaskHandle();
+    int i;
+
+    for( i = 0; i < testTASKS; i++ )
+    {
+        if( xTestTasks[ i ].xHandle == xRunning )
+        {
+            return &xTestTasks[ i ];
+        }
+    }
+
+    return NULL;
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    TestTask_t * pxRunning, * pxWasRunning = NULL;
+    unsigned long ulNow, ulRelease;
+    uint32_t ulHash = 2166136261UL;
+    int i, iStep, iInterrupts = 0, iExpectedJobs = 0, iJobs = 0, iErrors = 0;
+
+    for( i = 0; i < testTASKS; i++ )
+    {
+        if( xTaskPeriodicCreateConstrained( prvTask, xTestTasks[ i ].pcName, configMINIMAL_STACK_SIZE, NULL, 1, &xTestTasks[ i ].xHandle, xTestTasks[ i ].xPeriod,
+                                            xTestTasks[ i ].xPeriod, xTestTasks[ i ].ulWorkCounts / configEDF_BUDGET_COUNTS_PER_TICK + 1UL, 0 ) != pdPASS )
+        {
+            printf( "could not create %s\n", xTestTasks[ i ].pcName );
+            return EXIT_FAILURE;
+        }
+
+        xTestTasks[ i ].xLastRelease = xTaskGetReleaseTime( xTestTasks[ i ].xHandle );
+        xTestTasks[ i ].ulWorkLeft = xTestTasks[ i ].ulWorkCounts;
+    }
+
+    vHostStartScheduler();
+
+    for( iStep = 0; iStep < testSTEPS; iStep++ )
+    {
+        ulNow = T1TC;
+        pxRunning = prvRunning();
+        ulHash = ( ulHash ^ ( uint32_t ) ( ( pxRunning != NULL ) ? pxRunning->pcName[ 0 ] : '-' ) ) * 16777619UL;
+
+        /* A job starts running on a tick, when it is released or when the
+         * job before it finishes. */
+        if( ( pxRunning != NULL ) && ( pxRunning != pxWasRunning ) && ( pxRunning->ulWorkLeft == pxRunning->ulWorkCounts ) )
+        {
+            ulRelease = ( unsigned long ) xTaskGetReleaseTime( pxRunning->xHandle ) * configEDF_BUDGET_COUNTS_PER_TICK;
+
+            if( ( ulNow < ulRelease ) ||
+                ( ( ( ulNow % configEDF_BUDGET_COUNTS_PER_TICK ) != 0UL ) && ( pxWasRunning == NULL ) ) )
+            {
+                printf( "count %lu: %s started a job released at count %lu\n", ulNow, pxRunning->pcName, ulRelease );
+                iErrors++;
+            }
+        }
+
+        pxWasRunning = pxRunning;
+        T1TC += testSTEP_COUNTS;
+
+        if( pxRunning != NULL )
+        {
+            pxRunning->ulWorkLeft -= testSTEP_COUNTS;
+
+            if( pxRunning->ulWorkLeft == 0UL )
+            {
+                if( T1TC > ( unsigned long ) ( xTaskGetReleaseTime( pxRunning->xHandle ) + pxRunning->xPeriod ) * configEDF_BUDGET_COUNTS_PER_TICK )
+                {
+                    printf( "count %lu: %s finished late\n", T1TC, pxRunning->pcName );
+                    iErrors++;
+                }
+
+                if( xTaskGetReleaseTime( pxRunning->xHandle ) != ( TickType_t ) pxRunning->iJobs * pxRunning->xPeriod )
+                {
+                    printf( "count %lu: job %d of %s was released at tick %lu\n", T1TC, pxRunning->iJobs, pxRunning->pcName,
+                            ( unsigned long ) xTaskGetReleaseTime( pxRunning->xHandle ) );
+                    iErrors++;
+                }
+
+                pxRunning->iJobs++;
+                pxRunning->ulWorkLeft = pxRunning->ulWorkCounts;
+                ( void ) xTaskDelayUntil( &pxRunning->xLastRelease, pxRunning->xPeriod );
+                vTaskSwitchContext();
+            }
+        }
+
+        #if ( configUSE_EDF_EVENT_TICK == 1 )
+            {
+                if( ( xHostCompareArmed != pdFALSE ) && ( ( long ) ( T1TC - ulHostCompareValue ) >= 0L ) )
+                {
+                    xHostCompareArmed = pdFALSE;
+                    iInterrupts++;
+
+                    if( xTaskEDFEventTick() != pdFALSE )
+                    {
+                        vTaskSwitchContext();
+                    }
+                }
+            }
+        #else
+            {
+                if( ( T1TC % configEDF_BUDGET_COUNTS_PER_TICK ) == 0UL )
+                {
+                    iInterrupts++;
+
+                    if( xTaskIncrementTick() != pdFALSE )
+                    {
+                        vTaskSwitchContext();
+                    }
+                }
+            }
+        #endif
+    }
+
+    /* Every job released before the last deadline still to come has had time
+     * to finish. */
+    for( i = 0; i < testTASKS; i++ )
+    {
+        iExpectedJobs += ( int ) ( T1TC / configEDF_BUDGET_COUNTS_PER_TICK / xTestTasks[ i ].xPeriod ) - 1;
+        iJobs += xTestTasks[ i ].iJobs;
+
+        if( xTestTasks[ i ].iJobs < ( int ) ( T1TC / configEDF_BUDGET_COUNTS_PER_TICK / xTestTasks[ i ].xPeriod ) - 1 )
+        {
+            printf( "%s only completed %d jobs\n", xTestTasks[ i ].pcName, xTestTasks[ i ].iJobs );
+            iErrors++;
+        }
+    }
+
+    printf( "event_tick_test: %lu ticks, %d jobs (at least %d), %lu missed, %d errors, schedule %08lx, %s tick: %d interrupts\n",
+            T1TC / configEDF_BUDGET_COUNTS_PER_TICK, iJobs, iExpectedJobs, ( unsigned long ) uxHostDeadlineMisses, iErrors, ( unsigned long ) ulHash,
+            testTICK, iInterrupts );
+
+    return ( ( uxHostDeadlineMisses == 0 ) && ( iErrors == 0 ) ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,17 @@
+# The event tick test, with the event tick and with the periodic tick.  Both
+# must give the same schedule, the event tick with at most a fifth of the
+# interrupts.
+$(eval $(call program,event_tick_test_event,event_tick_test.c,configUSE_EDF_EVENT_TICK=1))
+$(eval $(call program,event_tick_test_periodic,event_tick_test.c,configUSE_EDF_EVENT_TICK=0))
+
+.PHONY: check_event_tick
+check_event_tick: $(BUILD)/event_tick_test_event/event_tick_test_event $(BUILD)/event_tick_test_periodic/event_tick_test_periodic
+	@set -e; \
+	periodic=$$($(BUILD)/event_tick_test_periodic/event_tick_test_periodic) || { echo "$$periodic"; exit 1; }; \
+	event=$$($(BUILD)/event_tick_test_event/event_tick_test_event) || { echo "$$event"; exit 1; }; \
+	echo "$$periodic"; echo "$$event"; \
+	[ "$${periodic%, * tick: *}" = "$${event%, * tick: *}" ] || { echo "the two ticks gave different schedules"; exit 1; }; \
+	periodic=$${periodic##*: }; event=$${event##*: }; \
+	[ $$(( $${event%% *} * 5 )) -le $${periodic%% *} ] || { echo "the event tick took more than a fifth of the interrupts"; exit 1; }
+
+CHECKS += check_event_tick
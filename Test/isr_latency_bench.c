@@ -0,0 +1,165 @@
+/*
+ * Times xTaskResumeFromISR(), the time an interrupt keeps interrupts masked
+ * to wake a task, with and without configUSE_EDF_ISR_RELEASE_QUEUE, using the
+ * sorted list ready queue.  'make bench' runs both builds for 8 to 512 tasks.
+ *
+ * n tasks are Ready, and one more, Z, has a deadline after all of theirs, so
+ * that putting it back in the sorted list walks the whole list.  Each round
+ * suspends Z, then times xTaskResumeFromISR() waking it and the
+ * vTaskSwitchContext() that follows, which is where the release queue is
+ * emptied into the ready queue.  Z must be Ready again after the switch, and
+ * must not have preempted the task with the earliest deadline.
+ *
+ * Every round does the same work, so the worst case is the time the kernel
+ * takes, but on a host the longest samples are the operating system's.  The
+ * 99th percentile is printed in place of the maximum.
+ *
+ * Usage: isr_latency_bench <number of tasks>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "host_port.h"
+
+#define benchMAX_TASKS    512
+#define benchROUNDS       20000
+
+#if ( configUSE_EDF_ISR_RELEASE_QUEUE == 1 )
+    #define benchWAKE    "queued"
+#else
+    #define benchWAKE    "direct"
+#endif
+
+static TaskHandle_t xTasks[ benchMAX_TASKS ];
+static uint64_t ullISRTimes[ benchROUNDS ];
+static uint64_t ullSwitchTimes[ benchROUNDS ];
+
+static void prvTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvNow( void )
+{
+    struct timespec xTime;
+
+    clock_gettime( CLOCK_MONOTONIC, &xTime );
+
+    return ( uint64_t ) xTime.tv_sec * 1000000000ULL + ( uint64_t ) xTime.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+static int prvCompare( const void * pvA,
+                       const void * pvB )
+{
+    const uint64_t ullA = *( const uint64_t * ) pvA;
+    const uint64_t ullB = *( const uint64_t * ) pvB;
+
+    return ( ullA > ullB ) - ( ullA < ullB );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSummarise( uint64_t * pullTimes,
+                          uint64_t * pullAverage,
+                          uint64_t * pullPercentile )
+{
+    uint64_t ullTotal = 0;
+    int i;
+
+    for( i = 0; i < benchROUNDS; i++ )
+    {
+        ullTotal += pullTimes[ i ];
+    }
+
+    qsort( pullTimes, benchROUNDS, sizeof( pullTimes[ 0 ] ), prvCompare );
+    *pullAverage = ullTotal / benchROUNDS;
+    *pullPercentile = pullTimes[ ( benchROUNDS * 99 ) / 100 ];
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char ** argv )
+{
+    uint64_t ullStart, ullISRAverage, ullISRPercentile, ullSwitchAverage, ullSwitchPercentile;
+    TaskHandle_t xLate;
+    char cName[ configMAX_TASK_NAME_LEN ];
+    int n, i, iRound, iErrors = 0;
+
+    n = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 64;
+
+    if( ( n < 1 ) || ( n > benchMAX_TASKS ) )
+    {
+        fprintf( stderr, "usage: %s <1..%d tasks>\n", argv[ 0 ], benchMAX_TASKS );
+        return EXIT_FAILURE;
+    }
+
+    for( i = 0; i < n; i++ )
+    {
+        snprintf( cName, sizeof( cName ), "T%d", i );
+
+        if( xTaskPeriodicCreate( prvTask, cName, configMINIMAL_STACK_SIZE, NULL, 1, &xTasks[ i ], ( TickType_t ) ( 1000 + i ) ) != pdPASS )
+        {
+            fprintf( stderr, "could not create task %d\n", i );
+            return EXIT_FAILURE;
+        }
+    }
+
+    if( xTaskPeriodicCreate( prvTask, "Z", configMINIMAL_STACK_SIZE, NULL, 1, &xLate, ( TickType_t ) 5000 ) != pdPASS )
+    {
+        fprintf( stderr, "could not create task Z\n" );
+        return EXIT_FAILURE;
+    }
+
+    vHostStartScheduler();
+
+    for( iRound = 0; iRound < benchROUNDS; iRound++ )
+    {
+        vTaskSuspend( xLate );
+        vTaskSwitchContext();
+
+        ullStart = prvNow();
+        ( void ) xTaskResumeFromISR( xLate );
+        ullISRTimes[ iRound ] = prvNow() - ullStart;
+
+        ullStart = prvNow();
+        vTaskSwitchContext();
+        ullSwitchTimes[ iRound ] = prvNow() - ullStart;
+
+        if( ( xTaskGetCurrentTaskHandle() != xTasks[ 0 ] ) || ( eTaskGetState( xLate ) != eReady ) )
+        {
+            iErrors++;
+        }
+    }
+
+    /* A task woken with the earliest deadline does preempt. */
+    vTaskSuspend( xTasks[ 0 ] );
+    vTaskSwitchContext();
+
+    if( xTaskResumeFromISR( xTasks[ 0 ] ) == pdFALSE )
+    {
+        iErrors++;
+    }
+
+    vTaskSwitchContext();
+
+    if( xTaskGetCurrentTaskHandle() != xTasks[ 0 ] )
+    {
+        iErrors++;
+    }
+
+    prvSummarise( ullISRTimes, &ullISRAverage, &ullISRPercentile );
+    prvSummarise( ullSwitchTimes, &ullSwitchAverage, &ullSwitchPercentile );
+
+    printf( "%s n=%3d  xTaskResumeFromISR avg %6llu ns p99 %6llu ns  next switch avg %6llu ns p99 %6llu ns  errors %d\n",
+            benchWAKE, n,
+            ( unsigned long long ) ullISRAverage, ( unsigned long long ) ullISRPercentile,
+            ( unsigned long long ) ullSwitchAverage, ( unsigned long long ) ullSwitchPercentile,
+            iErrors );
+
+    return ( iErrors == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,14 @@
+# The interrupt latency benchmark, waking a task from an interrupt straight
+# into the sorted ready list and through the ISR release queue.
+ISR_LATENCY_WAKES  := direct queued
+ISR_LATENCY_direct := configUSE_EDF_ISR_RELEASE_QUEUE=0
+ISR_LATENCY_queued := configUSE_EDF_ISR_RELEASE_QUEUE=1
+$(foreach w,$(ISR_LATENCY_WAKES),$(eval $(call program,isr_latency_bench_$(w),isr_latency_bench.c,$(ISR_LATENCY_$(w)))))
+
+.PHONY: bench_isr_latency
+bench_isr_latency: $(foreach w,$(ISR_LATENCY_WAKES),$(BUILD)/isr_latency_bench_$(w)/isr_latency_bench_$(w))
+	@set -e; for n in $(BENCH_TASKS); do \
+	    for w in $(ISR_LATENCY_WAKES); do $(BUILD)/isr_latency_bench_$$w/isr_latency_bench_$$w $$n; done; \
+	done
+
+BENCHES += bench_isr_latency
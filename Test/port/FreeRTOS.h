@@ -0,0 +1,242 @@
+/*
+ * Host stand-in for FreeRTOS.h and portmacro.h, neither of which is part of
+ * this tree.  It supplies the port types and macros, and the configuration
+ * defaults, that Src/task.c needs to build as an ordinary host program.  Tasks
+ * never run: a test drives the scheduler by calling the tick and context
+ * switch functions directly, and reads pxCurrentTCB to see what would run.
+ */
+
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FreeRTOSConfig.h"
+
+/*-----------------------------------------------------------
+ * Port types and macros.
+ *----------------------------------------------------------*/
+
+typedef uint32_t        StackType_t;
+typedef long            BaseType_t;
+typedef unsigned long   UBaseType_t;
+typedef uint32_t        TickType_t;
+
+#define portMAX_DELAY              ( TickType_t ) 0xffffffffUL
+#define portTICK_TYPE_IS_ATOMIC    1
+#define portSTACK_GROWTH           ( -1 )
+#define portBYTE_ALIGNMENT_MASK    ( 0x0007 )
+#define portPOINTER_SIZE_TYPE      uintptr_t
+
+#define pdFALSE                                  ( ( BaseType_t ) 0 )
+#define pdTRUE                                   ( ( BaseType_t ) 1 )
+#define pdPASS                                   ( pdTRUE )
+#define pdFAIL                                   ( pdFALSE )
+#define errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY    ( -1 )
+
+#define PRIVILEGED_FUNCTION
+#define PRIVILEGED_DATA
+#define portPRIVILEGE_BIT                     ( 0 )
+#define portUSING_MPU_WRAPPERS                0
+#define portHAS_STACK_OVERFLOW_CHECKING       0
+#define portNUM_CONFIGURABLE_REGIONS          1
+#define portCRITICAL_NESTING_IN_TCB           0
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
+#define configLIST_VOLATILE
+
+void vPortYield( void );
+void vPortEnterCritical( void );
+void vPortExitCritical( void );
+
+#define portYIELD()                                     vPortYield()
+#define portYIELD_WITHIN_API()                          vPortYield()
+#define taskYIELD()                                     portYIELD()
+#define taskENTER_CRITICAL()                            vPortEnterCritical()
+#define taskEXIT_CRITICAL()                             vPortExitCritical()
+#define portDISABLE_INTERRUPTS()
+#define portENABLE_INTERRUPTS()
+#define portSET_INTERRUPT_MASK_FROM_ISR()               0
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )          ( void ) ( x )
+#define portTICK_TYPE_ENTER_CRITICAL()
+#define portTICK_TYPE_EXIT_CRITICAL()
+#define portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR()     0
+#define portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( x )    ( void ) ( x )
+#define portASSERT_IF_INTERRUPT_PRIORITY_INVALID()
+#define portSOFTWARE_BARRIER()
+#define portMEMORY_BARRIER()
+#define portSETUP_TCB( pxTCB )                          ( void ) ( pxTCB )
+#define portCLEAN_UP_TCB( pxTCB )                       ( void ) ( pxTCB )
+#define portPRE_TASK_DELETE_HOOK( pvTaskToDelete, pxYieldPending )
+#define portALLOCATE_SECURE_CONTEXT( ulSecureStackSize )
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters )    void vFunction( void * pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters )          void vFunction( void * pvParameters )
+
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )    vPortSuppressTicksAndSleep( xExpectedIdleTime )
+
+void * pvPortMalloc( size_t xSize );
+void vPortFree( void * pv );
+#define pvPortMallocStack    pvPortMalloc
+#define vPortFreeStack       vPortFree
+
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+                                     void ( * pxCode )( void * ),
+                                     void * pvParameters );
+BaseType_t xPortStartScheduler( void );
+void vPortEndScheduler( void );
+
+/* The event tick arms a compare match on the budget counter.  The host port
+ * only records the value; a test that uses configUSE_EDF_EVENT_TICK provides
+ * vPortSetCompare() and delivers the match itself when the counter gets there. */
+void vPortSetCompare( unsigned long ulCompareValue );
+#define portEDF_SET_COMPARE( ulCompareValue )    vPortSetCompare( ulCompareValue )
+
+/*-----------------------------------------------------------
+ * Configuration defaults for the options Src/FreeRTOSConfig.h leaves out.
+ *----------------------------------------------------------*/
+
+#ifndef configASSERT
+    #define configASSERT( x )                                                              \
+    do {                                                                                   \
+        if( !( x ) )                                                                       \
+        {                                                                                  \
+            fprintf( stderr, "%s:%d: assertion failed: %s\n", __FILE__, __LINE__, #x );    \
+            abort();                                                                       \
+        }                                                                                  \
+    } while( 0 )
+    #define configASSERT_DEFINED    1
+#endif
+
+#ifndef configINITIAL_TICK_COUNT
+    #define configINITIAL_TICK_COUNT    0
+#endif
+
+#ifndef configUSE_TIME_SLICING
+    #define configUSE_TIME_SLICING    1
+#endif
+
+#ifndef configUSE_MUTEXES
+    #define configUSE_MUTEXES    0
+#endif
+
+#ifndef configUSE_TASK_NOTIFICATIONS
+    #define configUSE_TASK_NOTIFICATIONS    1
+#endif
+
+#ifndef configSUPPORT_DYNAMIC_ALLOCATION
+    #define configSUPPORT_DYNAMIC_ALLOCATION    1
+#endif
+
+#ifndef configSUPPORT_STATIC_ALLOCATION
+    #define configSUPPORT_STATIC_ALLOCATION    0
+#endif
+
+#ifndef configUSE_TICKLESS_IDLE
+    #define configUSE_TICKLESS_IDLE    0
+#endif
+
+#ifndef configUSE_TIMERS
+    #define configUSE_TIMERS    0
+#endif
+
+#ifndef INCLUDE_xTaskResumeFromISR
+    #define INCLUDE_xTaskResumeFromISR    1
+#endif
+
+#ifndef INCLUDE_xTaskDelayUntil
+    #define INCLUDE_xTaskDelayUntil    INCLUDE_vTaskDelayUntil
+#endif
+
+#ifndef INCLUDE_xTaskAbortDelay
+    #define INCLUDE_xTaskAbortDelay    0
+#endif
+
+#ifndef INCLUDE_xTaskGetIdleTaskHandle
+    #define INCLUDE_xTaskGetIdleTaskHandle    0
+#endif
+
+#ifndef INCLUDE_xTaskGetHandle
+    #define INCLUDE_xTaskGetHandle    0
+#endif
+
+#ifndef INCLUDE_eTaskGetState
+    #define INCLUDE_eTaskGetState    1
+#endif
+
+#ifndef INCLUDE_uxTaskGetStackHighWaterMark
+    #define INCLUDE_uxTaskGetStackHighWaterMark    0
+#endif
+
+#ifndef INCLUDE_uxTaskGetStackHighWaterMark2
+    #define INCLUDE_uxTaskGetStackHighWaterMark2    0
+#endif
+
+#ifndef INCLUDE_xTaskGetSchedulerState
+    #define INCLUDE_xTaskGetSchedulerState    0
+#endif
+
+#ifndef INCLUDE_xTaskGetCurrentTaskHandle
+    #define INCLUDE_xTaskGetCurrentTaskHandle    1
+#endif
+
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES         1
+#define configCHECK_FOR_STACK_OVERFLOW                0
+#define configRECORD_STACK_HIGH_ADDRESS               0
+#define configUSE_APPLICATION_TASK_TAG                0
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS       0
+#define configUSE_NEWLIB_REENTRANT                    0
+#define configUSE_POSIX_ERRNO                         0
+#define configSTACK_DEPTH_TYPE                        uint16_t
+#define configRUN_TIME_COUNTER_TYPE                   uint32_t
+#define configMINIMAL_SECURE_STACK_SIZE               0
+#define configEXPECTED_IDLE_TIME_BEFORE_SLEEP         2
+#define configINCLUDE_FREERTOS_TASK_C_ADDITIONS_H     0
+#define configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( x )
+#define tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE     0
+
+/*-----------------------------------------------------------
+ * Trace and coverage macros, all empty.
+ *----------------------------------------------------------*/
+
+#define mtCOVERAGE_TEST_MARKER()
+#define mtCOVERAGE_TEST_DELAY()
+#define taskCHECK_FOR_STACK_OVERFLOW()
+#define traceTASK_CREATE( pxNewTCB )
+#define traceTASK_CREATE_FAILED()
+#define traceTASK_DELETE( pxTaskToDelete )
+#define traceTASK_DELAY_UNTIL( x )
+#define traceTASK_DELAY()
+#define traceTASK_PRIORITY_SET( pxTask, uxNewPriority )
+#define traceTASK_SUSPEND( pxTaskToSuspend )
+#define traceTASK_RESUME( pxTaskToResume )
+#define traceTASK_RESUME_FROM_ISR( pxTaskToResume )
+#define traceTASK_INCREMENT_TICK( xTickCount )
+#define traceINCREASE_TICK_COUNT( x )
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )
+#define tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+#define traceTASK_PRIORITY_INHERIT( pxTCBOfMutexHolder, uxInheritedPriority )
+#define traceTASK_PRIORITY_DISINHERIT( pxTCBOfMutexHolder, uxOriginalPriority )
+#define traceLOW_POWER_IDLE_BEGIN()
+#define traceLOW_POWER_IDLE_END()
+#define traceTASK_NOTIFY_TAKE_BLOCK( uxIndexToWait )
+#define traceTASK_NOTIFY_TAKE( uxIndexToWait )
+#define traceTASK_NOTIFY_WAIT_BLOCK( uxIndexToWait )
+#define traceTASK_NOTIFY_WAIT( uxIndexToWait )
+#define traceTASK_NOTIFY( uxIndexToNotify )
+#define traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify )
+#define traceTASK_NOTIFY_GIVE_FROM_ISR( uxIndexToNotify )
+
+typedef struct xSTATIC_TCB
+{
+    void * pvDummy[ 64 ];
+} StaticTask_t;
+
+typedef void * MemoryRegion_t;
+
+#include "list.h"
+
+#endif /* INC_FREERTOS_H */
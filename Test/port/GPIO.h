@@ -0,0 +1,22 @@
+/*
+ * Host stand-in for the demo's GPIO driver, which the trace macros in
+ * Src/FreeRTOSConfig.h call on every context switch.
+ */
+
+#ifndef GPIO_H
+#define GPIO_H
+
+typedef enum
+{
+    PIN_IS_LOW,
+    PIN_IS_HIGH
+} pinState_t;
+
+#define PORT_0    0
+#define PORT_1    1
+
+void GPIO_write( int xPort,
+                 int xPin,
+                 pinState_t xState );
+
+#endif /* GPIO_H */
@@ -0,0 +1,127 @@
+/*
+ * Host port layer for building Src/task.c as an ordinary program.  Nothing
+ * here switches stacks: a test calls the tick and context switch functions
+ * itself wherever the interrupts and the yield would have run them on the
+ * target.
+ */
+
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "host_port.h"
+
+volatile unsigned long T1TC = 0UL;
+volatile unsigned long T1PR = 0UL;
+volatile unsigned long T1TCR = 0UL;
+volatile unsigned long VPBDIV = 0UL;
+
+UBaseType_t uxHostYields = 0;
+UBaseType_t uxHostDeadlineMisses = 0;
+TickType_t xHostDeadlineLateness = 0;
+UBaseType_t uxHostBudgetOverruns = 0;
+unsigned long ulHostCompareValue = 0UL;
+BaseType_t xHostCompareArmed = pdFALSE;
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+    uxHostYields++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xSize )
+{
+    return calloc( 1, xSize );
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    free( pv );
+}
+/*-----------------------------------------------------------*/
+
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+                                     void ( * pxCode )( void * ),
+                                     void * pvParameters )
+{
+    ( void ) pxCode;
+    ( void ) pvParameters;
+
+    return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+    return pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+    ( void ) xExpectedIdleTime;
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetCompare( unsigned long ulCompareValue )
+{
+    ulHostCompareValue = ulCompareValue;
+    xHostCompareArmed = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vHostStartScheduler( void )
+{
+    vTaskStartScheduler();
+    vTaskSwitchContext();
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationTickHook( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationDeadlineMissHook( TaskHandle_t xTask,
+                                   TickType_t xLateness )
+{
+    ( void ) xTask;
+
+    uxHostDeadlineMisses++;
+    xHostDeadlineLateness += xLateness;
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationBudgetOverrunHook( TaskHandle_t xTask )
+{
+    ( void ) xTask;
+
+    uxHostBudgetOverruns++;
+}
+/*-----------------------------------------------------------*/
+
+void GPIO_write( int xPort,
+                 int xPin,
+                 pinState_t xState )
+{
+    ( void ) xPort;
+    ( void ) xPin;
+    ( void ) xState;
+}
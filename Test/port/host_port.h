@@ -0,0 +1,30 @@
+/*
+ * State kept by the host port, for the tests to drive and inspect.
+ */
+
+#ifndef HOST_PORT_H
+#define HOST_PORT_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Number of times the kernel asked for a yield. */
+extern UBaseType_t uxHostYields;
+
+/* Number of vApplicationDeadlineMissHook() calls, and their total lateness. */
+extern UBaseType_t uxHostDeadlineMisses;
+extern TickType_t xHostDeadlineLateness;
+
+/* Number of vApplicationBudgetOverrunHook() calls. */
+extern UBaseType_t uxHostBudgetOverruns;
+
+/* Last value passed to portEDF_SET_COMPARE(), and whether it is still armed.
+ * A test clears xHostCompareArmed when it delivers the compare match. */
+extern unsigned long ulHostCompareValue;
+extern BaseType_t xHostCompareArmed;
+
+/* Start the scheduler and make the first context switch, which on a target
+ * is done by the port when it starts the first task. */
+void vHostStartScheduler( void );
+
+#endif /* HOST_PORT_H */
@@ -0,0 +1,16 @@
+/*
+ * Host stand-in for the LPC21xx register definitions included by
+ * Src/FreeRTOSConfig.h.  Only the Timer 1 registers the EDF budget counter
+ * reads are provided; host_port.c defines them as ordinary variables that a
+ * test advances by hand.
+ */
+
+#ifndef LPC21XX_H
+#define LPC21XX_H
+
+extern volatile unsigned long T1TC;
+extern volatile unsigned long T1PR;
+extern volatile unsigned long T1TCR;
+extern volatile unsigned long VPBDIV;
+
+#endif /* LPC21XX_H */
@@ -0,0 +1,19 @@
+#!/bin/sh
+# Usage: mkconfig.sh OUTPUT [NAME=VALUE ...]
+#
+# Write OUTPUT as a copy of Src/FreeRTOSConfig.h with each NAME redefined to
+# VALUE, so that one test source can be built in several configurations.
+
+out=$1
+shift
+src=$(dirname "$0")/../../Src/FreeRTOSConfig.h
+
+{
+    sed '/#endif \/\* FREERTOS_CONFIG_H \*\//d' "$src"
+    echo "/* Overrides for this test build. */"
+    for kv in "$@"; do
+        echo "#undef ${kv%%=*}"
+        echo "#define ${kv%%=*} ${kv#*=}"
+    done
+    echo "#endif /* FREERTOS_CONFIG_H */"
+} > "$out"
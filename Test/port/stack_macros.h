@@ -0,0 +1,9 @@
+/*
+ * Host stand-in for the FreeRTOS stack_macros.h.  The tests build with
+ * configCHECK_FOR_STACK_OVERFLOW set to 0, so there is nothing to check.
+ */
+
+#ifndef STACK_MACROS_H
+#define STACK_MACROS_H
+
+#endif /* STACK_MACROS_H */
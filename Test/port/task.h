@@ -0,0 +1,226 @@
+/*
+ * Host stand-in for the FreeRTOS task.h, which is not part of this tree.  It
+ * declares the types Src/task.c needs and the parts of the task API, including
+ * the EDF extensions, that the host tests call.
+ */
+
+#ifndef INC_TASK_H
+#define INC_TASK_H
+
+#include "list.h"
+
+struct tskTaskControlBlock;
+typedef struct tskTaskControlBlock * TaskHandle_t;
+
+struct xEDF_SRP_RESOURCE;
+typedef struct xEDF_SRP_RESOURCE * SRPResourceHandle_t;
+
+typedef void (* TaskFunction_t)( void * );
+typedef BaseType_t (* TaskHookFunction_t)( void * );
+
+typedef enum
+{
+    eRunning = 0,
+    eReady,
+    eBlocked,
+    eSuspended,
+    eDeleted,
+    eInvalid
+} eTaskState;
+
+typedef enum
+{
+    eNoAction = 0,
+    eSetBits,
+    eIncrement,
+    eSetValueWithOverwrite,
+    eSetValueWithoutOverwrite
+} eNotifyAction;
+
+typedef enum
+{
+    eAbortSleep = 0,
+    eStandardSleep,
+    eNoTasksWaitingTimeout
+} eSleepModeStatus;
+
+typedef struct xTIME_OUT
+{
+    BaseType_t xOverflowCount;
+    TickType_t xTimeOnEntering;
+} TimeOut_t;
+
+typedef struct xTASK_STATUS
+{
+    TaskHandle_t xHandle;
+    const char * pcTaskName;
+    UBaseType_t xTaskNumber;
+    eTaskState eCurrentState;
+    UBaseType_t uxCurrentPriority;
+    UBaseType_t uxBasePriority;
+    configRUN_TIME_COUNTER_TYPE ulRunTimeCounter;
+    StackType_t * pxStackBase;
+    configSTACK_DEPTH_TYPE usStackHighWaterMark;
+} TaskStatus_t;
+
+#define tskIDLE_PRIORITY             ( ( UBaseType_t ) 0U )
+
+#define taskSCHEDULER_SUSPENDED      ( ( BaseType_t ) 0 )
+#define taskSCHEDULER_NOT_STARTED    ( ( BaseType_t ) 1 )
+#define taskSCHEDULER_RUNNING        ( ( BaseType_t ) 2 )
+
+/*-----------------------------------------------------------
+ * Task creation and control.
+ *----------------------------------------------------------*/
+
+BaseType_t xTaskCreate( TaskFunction_t pxTaskCode,
+                        const char * const pcName,
+                        const configSTACK_DEPTH_TYPE usStackDepth,
+                        void * const pvParameters,
+                        UBaseType_t uxPriority,
+                        TaskHandle_t * const pxCreatedTask );
+void vTaskDelete( TaskHandle_t xTaskToDelete );
+void vTaskDelay( const TickType_t xTicksToDelay );
+BaseType_t xTaskDelayUntil( TickType_t * const pxPreviousWakeTime,
+                            const TickType_t xTimeIncrement );
+#define vTaskDelayUntil( pxPreviousWakeTime, xTimeIncrement )                   \
+    do {                                                                        \
+        ( void ) xTaskDelayUntil( ( pxPreviousWakeTime ), ( xTimeIncrement ) ); \
+    } while( 0 )
+BaseType_t xTaskAbortDelay( TaskHandle_t xTask );
+eTaskState eTaskGetState( TaskHandle_t xTask );
+void vTaskSuspend( TaskHandle_t xTaskToSuspend );
+void vTaskResume( TaskHandle_t xTaskToResume );
+BaseType_t xTaskResumeFromISR( TaskHandle_t xTaskToResume );
+char * pcTaskGetName( TaskHandle_t xTaskToQuery );
+TaskHandle_t xTaskGetCurrentTaskHandle( void );
+BaseType_t xTaskGetSchedulerState( void );
+UBaseType_t uxTaskGetNumberOfTasks( void );
+UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
+                                  const UBaseType_t uxArraySize,
+                                  configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime );
+
+/*-----------------------------------------------------------
+ * Scheduler control.
+ *----------------------------------------------------------*/
+
+void vTaskStartScheduler( void );
+void vTaskEndScheduler( void );
+void vTaskSuspendAll( void );
+BaseType_t xTaskResumeAll( void );
+TickType_t xTaskGetTickCount( void );
+TickType_t xTaskGetTickCountFromISR( void );
+
+/*-----------------------------------------------------------
+ * EDF extensions.
+ *----------------------------------------------------------*/
+
+BaseType_t xTaskPeriodicCreate( TaskFunction_t pxTaskCode,
+                                const char * const pcName,
+                                const configSTACK_DEPTH_TYPE usStackDepth,
+                                void * const pvParameters,
+                                UBaseType_t uxPriority,
+                                TaskHandle_t * const pxCreatedTask,
+                                TickType_t period );
+BaseType_t xTaskPeriodicCreateConstrained( TaskFunction_t pxTaskCode,
+                                           const char * const pcName,
+                                           const configSTACK_DEPTH_TYPE usStackDepth,
+                                           void * const pvParameters,
+                                           UBaseType_t uxPriority,
+                                           TaskHandle_t * const pxCreatedTask,
+                                           const TickType_t xPeriod,
+                                           const TickType_t xRelativeDeadline,
+                                           const TickType_t xWCET,
+                                           const TickType_t xPhase );
+BaseType_t xTaskPeriodicCreateShared( TaskFunction_t pxJobCode,
+                                      const char * const pcName,
+                                      void * const pvParameters,
+                                      UBaseType_t uxPriority,
+                                      TaskHandle_t * const pxCreatedTask,
+                                      const TickType_t xPeriod,
+                                      const TickType_t xRelativeDeadline,
+                                      const TickType_t xWCET,
+                                      const TickType_t xPhase );
+BaseType_t xTaskCBSCreate( TaskFunction_t pxTaskCode,
+                           const char * const pcName,
+                           const configSTACK_DEPTH_TYPE usStackDepth,
+                           void * const pvParameters,
+                           UBaseType_t uxPriority,
+                           TaskHandle_t * const pxCreatedTask,
+                           const TickType_t xBudget,
+                           const TickType_t xPeriod );
+BaseType_t xTaskCBSAttach( TaskHandle_t xTask,
+                           const TickType_t xBudget,
+                           const TickType_t xPeriod );
+TickType_t xTaskGetReleaseTime( TaskHandle_t xTask );
+BaseType_t xTaskCheckSchedulability( const TickType_t xPeriod,
+                                     const TickType_t xRelativeDeadline,
+                                     const TickType_t xWCET,
+                                     TickType_t * const pxFailingInterval );
+void vTaskGetDeadlineMissStats( TaskHandle_t xTask,
+                                UBaseType_t * const puxMisses,
+                                TickType_t * const pxMaxLateness,
+                                uint32_t * const pulTotalLateness );
+UBaseType_t uxTaskGetBudgetOverruns( TaskHandle_t xTask );
+UBaseType_t uxTaskGetAvoidedPreemptionCount( void );
+void vTaskGetTieBreakStats( UBaseType_t * const puxContextSwitches,
+                            UBaseType_t * const puxTiesKept,
+                            UBaseType_t * const puxTieSwitches );
+BaseType_t xTaskGetNextJobRecord( TaskHandle_t * const pxTask,
+                                  TickType_t * const pxReleaseTime,
+                                  uint32_t * const pulStartTime,
+                                  uint32_t * const pulFinishTime,
+                                  TickType_t * const pxLateness,
+                                  UBaseType_t * const puxPreemptions );
+UBaseType_t uxTaskGetLostJobRecordCount( void );
+SRPResourceHandle_t xTaskSRPResourceCreate( void );
+void vTaskSRPResourceUsedBy( SRPResourceHandle_t xResource,
+                             TaskHandle_t xTask );
+void vTaskSRPLock( SRPResourceHandle_t xResource );
+void vTaskSRPUnlock( SRPResourceHandle_t xResource );
+
+/* The values configEDF_BUDGET_OVERRUN_ACTION can take, as Src/task.c defines
+ * them, for the tests that depend on the action. */
+#define tskEDF_BUDGET_THROTTLE    0
+#define tskEDF_BUDGET_DEMOTE      1
+#define tskEDF_BUDGET_NOTIFY      2
+
+/* The values configEDF_TIE_BREAK can take, as Src/task.c defines them, for the
+ * tests that depend on the policy. */
+#define tskEDF_TIE_KEEP_RUNNING    0
+#define tskEDF_TIE_FIFO            1
+#define tskEDF_TIE_ROUND_ROBIN     2
+
+/*-----------------------------------------------------------
+ * Scheduler internals, called by the port and, here, by the tests in place of
+ * the tick and compare interrupts.
+ *----------------------------------------------------------*/
+
+BaseType_t xTaskIncrementTick( void );
+BaseType_t xTaskEDFEventTick( void );
+BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp );
+void vTaskSwitchContext( void );
+void vTaskMissedYield( void );
+void vTaskPlaceOnEventList( List_t * const pxEventList,
+                            const TickType_t xTicksToWait );
+BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList );
+void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut );
+void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut );
+BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut,
+                                 TickType_t * const pxTicksToWait );
+TickType_t uxTaskResetEventItemValue( void );
+void vTaskSetTaskNumber( TaskHandle_t xTask,
+                         const UBaseType_t uxHandle );
+UBaseType_t uxTaskGetTaskNumber( TaskHandle_t xTask );
+BaseType_t xTaskPriorityInherit( TaskHandle_t const pxMutexHolder );
+BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder );
+void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder,
+                                          UBaseType_t uxHighestPriorityWaitingTask );
+TaskHandle_t pvTaskIncrementMutexHeldCount( void );
+
+/* Hooks the application provides. */
+void vApplicationTickHook( void );
+void vApplicationDeadlineMissHook( TaskHandle_t xTask,
+                                   TickType_t xLateness );
+
+#endif /* INC_TASK_H */
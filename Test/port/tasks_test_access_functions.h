@@ -0,0 +1,69 @@
+/*
+ * Included at the end of Src/task.c when FREERTOS_MODULE_TEST is defined, to
+ * give the host tests access to functions that are static to that file.
+ */
+
+#ifndef TASKS_TEST_ACCESS_FUNCTIONS_H
+#define TASKS_TEST_ACCESS_FUNCTIONS_H
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_ADMISSION_CONTROL == 1 ) )
+
+/* Run the processor-demand test on a task set given as separate arrays of
+ * periods, relative deadlines and WCETs, rather than on the admitted tasks. */
+    BaseType_t xTestEDFDemandTest( const TickType_t * const pxPeriods,
+                                   const TickType_t * const pxRelativeDeadlines,
+                                   const TickType_t * const pxWCETs,
+                                   const UBaseType_t uxTaskCount,
+                                   uint32_t * const pulFailingInterval )
+    {
+        EDFTaskParameters_t xTasks[ configEDF_MAX_ADMITTED_TASKS ];
+        UBaseType_t uxTask;
+
+        configASSERT( uxTaskCount <= ( UBaseType_t ) configEDF_MAX_ADMITTED_TASKS );
+
+        for( uxTask = ( UBaseType_t ) 0U; uxTask < uxTaskCount; uxTask++ )
+        {
+            xTasks[ uxTask ].xPeriod = pxPeriods[ uxTask ];
+            xTasks[ uxTask ].xRelativeDeadline = pxRelativeDeadlines[ uxTask ];
+            xTasks[ uxTask ].xWCET = pxWCETs[ uxTask ];
+        }
+
+        return prvEDFDemandTest( xTasks, uxTaskCount, pulFailingInterval );
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_ADMISSION_CONTROL == 1 ) */
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SHARED_STACK == 1 ) )
+
+/* The task whose job is on top of the shared stack, or NULL. */
+    TaskHandle_t xTestEDFSharedStackTop( void )
+    {
+        return ( TaskHandle_t ) pxEDFSharedStackTop;
+    }
+
+/* The task whose job is below that of xTask on the shared stack, or NULL. */
+    TaskHandle_t xTestEDFSharedStackBelow( TaskHandle_t xTask )
+    {
+        return ( TaskHandle_t ) ( ( TCB_t * ) xTask )->pxSharedStackPrevious;
+    }
+
+/* Do what prvEDFSharedStackJob() does when the job function of the running
+ * task returns, as no task code runs on the host. */
+    void vTestEDFSharedJobCompleted( void )
+    {
+        TCB_t * const pxTCB = pxCurrentTCB;
+        TickType_t xReleaseTime = pxTCB->xReleaseTime;
+
+        pxTCB->uxSharedStackJob = taskEDF_JOB_COMPLETED;
+        ( void ) xTaskDelayUntil( &xReleaseTime, pxTCB->xTaskPeriod );
+
+        /* The task only carries on from here if it did not block. */
+        if( pxTCB->uxSharedStackJob == taskEDF_JOB_COMPLETED )
+        {
+            pxTCB->uxSharedStackJob = taskEDF_JOB_STARTED;
+        }
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SHARED_STACK == 1 ) */
+
+#endif /* TASKS_TEST_ACCESS_FUNCTIONS_H */
@@ -0,0 +1,9 @@
+/*
+ * Host stand-in for the FreeRTOS timers.h.  The tests build with
+ * configUSE_TIMERS set to 0, so Src/task.c needs nothing from it.
+ */
+
+#ifndef TIMERS_H
+#define TIMERS_H
+
+#endif /* TIMERS_H */
@@ -0,0 +1,223 @@
+/*
+ * Checks the processor-demand (QPA) admission test in Src/task.c against
+ * brute force.  Random constrained-deadline task sets are run through the
+ * kernel's test and through a unit-time EDF simulation of the synchronous
+ * release pattern over the hyperperiod plus the longest deadline, which misses
+ * a deadline exactly when the set is not schedulable.  When both reject a set,
+ * the failing interval the kernel reports is checked against a scan of the
+ * demand bound function h( t ) for the first t with h( t ) > t.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define testSETS         50000
+#define testMAX_TASKS    6
+
+BaseType_t xTestEDFDemandTest( const TickType_t * const pxPeriods,
+                               const TickType_t * const pxRelativeDeadlines,
+                               const TickType_t * const pxWCETs,
+                               const UBaseType_t uxTaskCount,
+                               uint32_t * const pulFailingInterval );
+
+static const TickType_t xPeriodChoices[] = { 4, 5, 6, 8, 10, 12, 15, 20, 25, 30, 40, 50, 60 };
+
+static unsigned long prvGCD( unsigned long a,
+                             unsigned long b )
+{
+    while( b != 0UL )
+    {
+        unsigned long t = a % b;
+
+        a = b;
+        b = t;
+    }
+
+    return a;
+}
+/*-----------------------------------------------------------*/
+
+/* Run EDF one time unit at a time from a synchronous release up to
+ * ulHorizon, returning pdTRUE if no job misses its deadline.  With deadlines no
+ * longer than periods a task never has more than one job pending unless one
+ * has already been missed. */
+static BaseType_t prvSimulateEDF( const TickType_t * pxP,
+                                  const TickType_t * pxD,
+                                  const TickType_t * pxC,
+                                  int n,
+                                  unsigned long ulHorizon )
+{
+    unsigned long ulRemaining[ testMAX_TASKS ] = { 0 };
+    unsigned long ulDeadline[ testMAX_TASKS ] = { 0 };
+    unsigned long t;
+    int i, iRun;
+
+    for( t = 0; t < ulHorizon; t++ )
+    {
+        for( i = 0; i < n; i++ )
+        {
+            if( ( ulRemaining[ i ] != 0UL ) && ( ulDeadline[ i ] <= t ) )
+            {
+                return pdFALSE;
+            }
+
+            if( ( t % pxP[ i ] ) == 0UL )
+            {
+                ulRemaining[ i ] = pxC[ i ];
+                ulDeadline[ i ] = t + pxD[ i ];
+            }
+        }
+
+        iRun = -1;
+
+        for( i = 0; i < n; i++ )
+        {
+            if( ( ulRemaining[ i ] != 0UL ) && ( ( iRun < 0 ) || ( ulDeadline[ i ] < ulDeadline[ iRun ] ) ) )
+            {
+                iRun = i;
+            }
+        }
+
+        if( iRun >= 0 )
+        {
+            ulRemaining[ iRun ]--;
+        }
+    }
+
+    for( i = 0; i < n; i++ )
+    {
+        if( ( ulRemaining[ i ] != 0UL ) && ( ulDeadline[ i ] <= ulHorizon ) )
+        {
+            return pdFALSE;
+        }
+    }
+
+    return pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+/* First interval length t, up to ulHorizon, at which the demand of the jobs
+ * with both release and deadline in [ 0, t ] exceeds t, or 0 if there is none. */
+static unsigned long prvFirstDemandOverload( const TickType_t * pxP,
+                                             const TickType_t * pxD,
+                                             const TickType_t * pxC,
+                                             int n,
+                                             unsigned long ulHorizon )
+{
+    unsigned long t, ulDemand;
+    int i;
+
+    for( t = 1; t <= ulHorizon; t++ )
+    {
+        ulDemand = 0;
+
+        for( i = 0; i < n; i++ )
+        {
+            if( t >= pxD[ i ] )
+            {
+                ulDemand += ( ( t - pxD[ i ] ) / pxP[ i ] + 1UL ) * pxC[ i ];
+            }
+        }
+
+        if( ulDemand > t )
+        {
+            return t;
+        }
+    }
+
+    return 0UL;
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    TickType_t xP[ testMAX_TASKS ], xD[ testMAX_TASKS ], xC[ testMAX_TASKS ];
+    unsigned long ulHyperperiod, ulMaxDeadline, ulHyperDemand, ulFirst;
+    uint32_t ulReported;
+    BaseType_t xKernel, xSimulated;
+    int iSet, i, n, iErrors = 0, iAccepted = 0, iRejected = 0;
+
+    srand( 1 );
+
+    for( iSet = 0; iSet < testSETS; iSet++ )
+    {
+        n = 1 + rand() % testMAX_TASKS;
+        ulHyperperiod = 1UL;
+        ulMaxDeadline = 0UL;
+        ulHyperDemand = 0UL;
+
+        for( i = 0; i < n; i++ )
+        {
+            xP[ i ] = xPeriodChoices[ rand() % ( int ) ( sizeof( xPeriodChoices ) / sizeof( xPeriodChoices[ 0 ] ) ) ];
+            xD[ i ] = 1 + rand() % xP[ i ];
+
+            /* Mostly light tasks, so that sets of several tasks are not all
+             * overloaded. */
+            if( ( rand() % 3 ) != 0 )
+            {
+                xC[ i ] = 1 + rand() % ( ( xD[ i ] + 2 ) / 3 );
+            }
+            else
+            {
+                xC[ i ] = 1 + rand() % xD[ i ];
+            }
+
+            ulHyperperiod = ulHyperperiod / prvGCD( ulHyperperiod, xP[ i ] ) * xP[ i ];
+
+            if( xD[ i ] > ulMaxDeadline )
+            {
+                ulMaxDeadline = xD[ i ];
+            }
+        }
+
+        for( i = 0; i < n; i++ )
+        {
+            ulHyperDemand += xC[ i ] * ( ulHyperperiod / xP[ i ] );
+        }
+
+        xSimulated = prvSimulateEDF( xP, xD, xC, n, ulHyperperiod + ulMaxDeadline );
+        xKernel = xTestEDFDemandTest( xP, xD, xC, ( UBaseType_t ) n, &ulReported );
+
+        if( xKernel != xSimulated )
+        {
+            iErrors++;
+            printf( "set %d: QPA says %s, simulation says %s:", iSet,
+                    ( xKernel == pdPASS ) ? "schedulable" : "not schedulable",
+                    ( xSimulated == pdPASS ) ? "schedulable" : "not schedulable" );
+
+            for( i = 0; i < n; i++ )
+            {
+                printf( " (C=%lu D=%lu T=%lu)", ( unsigned long ) xC[ i ], ( unsigned long ) xD[ i ], ( unsigned long ) xP[ i ] );
+            }
+
+            printf( "\n" );
+        }
+        else if( xKernel != pdPASS )
+        {
+            /* The kernel reports 0 when the utilization alone is above 1. */
+            ulFirst = ( ulHyperDemand > ulHyperperiod ) ? 0UL : prvFirstDemandOverload( xP, xD, xC, n, ulHyperperiod + ulMaxDeadline );
+
+            if( ulReported != ulFirst )
+            {
+                iErrors++;
+                printf( "set %d: failing interval %lu, expected %lu\n", iSet, ( unsigned long ) ulReported, ulFirst );
+            }
+        }
+
+        if( xKernel == pdPASS )
+        {
+            iAccepted++;
+        }
+        else
+        {
+            iRejected++;
+        }
+    }
+
+    printf( "qpa_test: %d sets, %d schedulable, %d not, %d errors\n", testSETS, iAccepted, iRejected, iErrors );
+
+    return ( iErrors == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
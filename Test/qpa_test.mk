@@ -0,0 +1,8 @@
+# The QPA admission test against a simulation of EDF.
+$(eval $(call program,qpa_test,qpa_test.c,))
+
+.PHONY: check_qpa
+check_qpa: $(BUILD)/qpa_test/qpa_test
+	@$(BUILD)/qpa_test/qpa_test
+
+CHECKS += check_qpa
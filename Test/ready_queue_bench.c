@@ -0,0 +1,146 @@
+/*
+ * Times the EDF ready queue with n tasks Ready.  It is built once for each
+ * queue: the sorted list, the heap (configUSE_EDF_HEAP_READY_QUEUE) and the
+ * buckets (configUSE_EDF_BUCKET_READY_QUEUE).  'make bench' runs every build for
+ * n = 8 to 512.
+ *
+ * All n tasks are released at once with deadlines spread over 8 to 255 ticks,
+ * and the tick is never advanced, so every task stays Ready.  Each round
+ * suspends a task chosen at random, which removes it from the queue, then
+ * times vTaskResume() putting it back, the same insertion a release does, and
+ * vTaskSwitchContext() selecting the earliest deadline.  The selection is
+ * checked against every Ready task's deadline after each round.
+ *
+ * Usage: ready_queue_bench <number of tasks>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "host_port.h"
+
+#define benchMAX_TASKS    512
+#define benchROUNDS       20000
+
+#if ( configUSE_EDF_HEAP_READY_QUEUE == 1 )
+    #define benchQUEUE    "heap"
+#elif ( configUSE_EDF_BUCKET_READY_QUEUE == 1 )
+    #define benchQUEUE    "bucket"
+#else
+    #define benchQUEUE    "list"
+#endif
+
+static TaskHandle_t xTasks[ benchMAX_TASKS ];
+static TickType_t xPeriods[ benchMAX_TASKS ];
+
+static void prvTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvNow( void )
+{
+    struct timespec xTime;
+
+    clock_gettime( CLOCK_MONOTONIC, &xTime );
+
+    return ( uint64_t ) xTime.tv_sec * 1000000000ULL + ( uint64_t ) xTime.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+/* pdTRUE if no Ready task has an earlier deadline than the running one. */
+static BaseType_t prvRunningTaskHasEarliestDeadline( int n )
+{
+    TaskHandle_t xRunning = xTaskGetCurrentTaskHandle();
+    TickType_t xRunningDeadline = portMAX_DELAY;
+    int i;
+
+    for( i = 0; i < n; i++ )
+    {
+        if( xTasks[ i ] == xRunning )
+        {
+            xRunningDeadline = xPeriods[ i ];
+        }
+    }
+
+    for( i = 0; i < n; i++ )
+    {
+        if( ( eTaskGetState( xTasks[ i ] ) == eReady ) &&
+            ( xPeriods[ i ] < xRunningDeadline ) )
+        {
+            return pdFALSE;
+        }
+    }
+
+    return pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char ** argv )
+{
+    uint64_t ullStart, ullTime, ullInsertTotal = 0, ullInsertWorst = 0, ullSelectTotal = 0, ullSelectWorst = 0;
+    unsigned long ulRandom = 1UL;
+    char cName[ configMAX_TASK_NAME_LEN ];
+    int n, i, iRound, iErrors = 0;
+
+    n = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 64;
+
+    if( ( n < 1 ) || ( n > benchMAX_TASKS ) )
+    {
+        fprintf( stderr, "usage: %s <1..%d tasks>\n", argv[ 0 ], benchMAX_TASKS );
+        return EXIT_FAILURE;
+    }
+
+    for( i = 0; i < n; i++ )
+    {
+        snprintf( cName, sizeof( cName ), "T%d", i );
+        xPeriods[ i ] = ( TickType_t ) ( 8 + ( i * 97 ) % 248 );
+
+        if( xTaskPeriodicCreate( prvTask, cName, configMINIMAL_STACK_SIZE, NULL, 1, &xTasks[ i ], xPeriods[ i ] ) != pdPASS )
+        {
+            fprintf( stderr, "could not create task %d\n", i );
+            return EXIT_FAILURE;
+        }
+    }
+
+    vHostStartScheduler();
+
+    for( iRound = 0; iRound < benchROUNDS; iRound++ )
+    {
+        ulRandom = ulRandom * 1103515245UL + 12345UL;
+        i = ( int ) ( ( ulRandom >> 8 ) % ( unsigned long ) n );
+
+        vTaskSuspend( xTasks[ i ] );
+        vTaskSwitchContext();
+
+        ullStart = prvNow();
+        vTaskResume( xTasks[ i ] );
+        ullTime = prvNow() - ullStart;
+        ullInsertTotal += ullTime;
+        ullInsertWorst = ( ullTime > ullInsertWorst ) ? ullTime : ullInsertWorst;
+
+        ullStart = prvNow();
+        vTaskSwitchContext();
+        ullTime = prvNow() - ullStart;
+        ullSelectTotal += ullTime;
+        ullSelectWorst = ( ullTime > ullSelectWorst ) ? ullTime : ullSelectWorst;
+
+        if( prvRunningTaskHasEarliestDeadline( n ) == pdFALSE )
+        {
+            iErrors++;
+        }
+    }
+
+    printf( "%-6s n=%3d  insert avg %6llu ns worst %7llu ns  select avg %6llu ns worst %7llu ns  errors %d\n",
+            benchQUEUE, n,
+            ( unsigned long long ) ( ullInsertTotal / benchROUNDS ), ( unsigned long long ) ullInsertWorst,
+            ( unsigned long long ) ( ullSelectTotal / benchROUNDS ), ( unsigned long long ) ullSelectWorst,
+            iErrors );
+
+    return ( iErrors == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
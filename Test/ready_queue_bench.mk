@@ -0,0 +1,15 @@
+# The ready queue benchmark, once for each EDF ready queue.
+READY_QUEUE_BENCH_QUEUES   := list heap bucket
+READY_QUEUE_BENCH_CONFIG   := configEDF_MAX_READY_TASKS=520
+READY_QUEUE_BENCH_list     :=
+READY_QUEUE_BENCH_heap     := configUSE_EDF_HEAP_READY_QUEUE=1
+READY_QUEUE_BENCH_bucket   := configUSE_EDF_BUCKET_READY_QUEUE=1
+$(foreach q,$(READY_QUEUE_BENCH_QUEUES),$(eval $(call program,ready_queue_bench_$(q),ready_queue_bench.c,$(READY_QUEUE_BENCH_CONFIG) $(READY_QUEUE_BENCH_$(q)))))
+
+.PHONY: bench_ready_queue
+bench_ready_queue: $(foreach q,$(READY_QUEUE_BENCH_QUEUES),$(BUILD)/ready_queue_bench_$(q)/ready_queue_bench_$(q))
+	@set -e; for n in $(BENCH_TASKS); do \
+	    for q in $(READY_QUEUE_BENCH_QUEUES); do $(BUILD)/ready_queue_bench_$$q/ready_queue_bench_$$q $$n; done; \
+	done
+
+BENCHES += bench_ready_queue
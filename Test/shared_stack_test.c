@@ -0,0 +1,276 @@
+/*
+ * Runs tasks created by xTaskPeriodicCreateShared() and checks that their jobs
+ * use the shared stack last-in, first-out.  It is built with
+ * configEDF_BUDGET_OVERRUN_ACTION set to tskEDF_BUDGET_THROTTLE and to
+ * tskEDF_BUDGET_NOTIFY.
+ *
+ * A, B and C have periods of 40, 20 and 10 ticks, relative deadlines of 40,
+ * 12 and 5 and phases of 0, 1 and 2, and jobs of 8, 4 and 2 ticks of work, so
+ * every 40 ticks C preempts B, which preempts A.  The program keeps its own
+ * stack of the jobs that have started and not completed.  After every context
+ * switch the running job must be on top of it, and the chain of jobs the
+ * kernel keeps on the shared stack must match it.  No deadline may be missed.
+ *
+ * Under throttling a task with a WCET must be refused, so the tasks have none.
+ * Under notification C has a WCET of 1 tick, so each of its jobs overruns:
+ * it must be left to run, and vApplicationBudgetOverrunHook() must be called
+ * once per job.  In both builds xTaskCBSAttach() must refuse A.  After tick
+ * 100, B is deleted while its job is preempted by C, and the stack must still
+ * be used in order.
+ *
+ * Usage: shared_stack_test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "host_port.h"
+
+#define testTASKS           3
+#define testTICKS           400
+#define testDELETE_AFTER    100
+
+#if ( configEDF_BUDGET_OVERRUN_ACTION == tskEDF_BUDGET_NOTIFY )
+    #define testACTION    "notify"
+#else
+    #define testACTION    "throttle"
+#endif
+
+TaskHandle_t xTestEDFSharedStackTop( void );
+TaskHandle_t xTestEDFSharedStackBelow( TaskHandle_t xTask );
+void vTestEDFSharedJobCompleted( void );
+
+typedef struct
+{
+    const char * pcName;
+    TickType_t xPeriod;
+    TickType_t xRelativeDeadline;
+    TickType_t xPhase;
+    TickType_t xWork;
+    TickType_t xWCET;
+    TaskHandle_t xHandle;
+    TickType_t xWorkLeft;
+    BaseType_t xStarted;
+    BaseType_t xDeleted;
+    int iJobs;
+} TestTask_t;
+
+/* Only C overruns, and only when its overruns are notified. */
+static TestTask_t xTestTasks[ testTASKS ] =
+{
+    { "A", 40, 40, 0, 8, 8 },
+    { "B", 20, 12, 1, 4, 4 },
+    { "C", 10, 5,  2, 2, 1 }
+};
+
+/* The jobs that have started and not completed, in the order they started. */
+static TestTask_t * pxStarted[ testTASKS ];
+static int iStarted = 0;
+
+static void prvJob( void * pvParameters )
+{
+    ( void ) pvParameters;
+}
+/*-----------------------------------------------------------*/
+
+static TestTask_t * prvRunning( void )
+{
+    TaskHandle_t xRunning = xTaskGetCurrentTaskHandle();
+    int i;
+
+    for( i = 0; i < testTASKS; i++ )
+    {
+        if( ( xTestTasks[ i ].xDeleted == pdFALSE ) && ( xTestTasks[ i ].xHandle == xRunning ) )
+        {
+            return &xTestTasks[ i ];
+        }
+    }
+
+    return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveStarted( TestTask_t * pxTask )
+{
+    int i, j;
+
+    for( i = 0; i < iStarted; i++ )
+    {
+        if( pxStarted[ i ] == pxTask )
+        {
+            for( j = i; j < ( iStarted - 1 ); j++ )
+            {
+                pxStarted[ j ] = pxStarted[ j + 1 ];
+            }
+
+            iStarted--;
+            break;
+        }
+    }
+
+    pxTask->xStarted = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+/* Start the job of the running task if it has not started, and check it is on
+ * top of the stack and that the kernel's chain matches. */
+static int prvCheckStack( TickType_t xNow )
+{
+    TestTask_t * pxRunning = prvRunning();
+    TaskHandle_t xJob;
+    int i, iErrors = 0;
+
+    if( pxRunning != NULL )
+    {
+        if( pxRunning->xStarted == pdFALSE )
+        {
+            pxRunning->xStarted = pdTRUE;
+            pxRunning->iJobs++;
+            pxStarted[ iStarted ] = pxRunning;
+            iStarted++;
+        }
+        else if( pxStarted[ iStarted - 1 ] != pxRunning )
+        {
+            printf( "tick %lu: %s runs below %s on the shared stack\n", ( unsigned long ) xNow,
+                    pxRunning->pcName, pxStarted[ iStarted - 1 ]->pcName );
+            iErrors++;
+        }
+    }
+
+    xJob = xTestEDFSharedStackTop();
+
+    for( i = iStarted - 1; i >= 0; i-- )
+    {
+        if( xJob != pxStarted[ i ]->xHandle )
+        {
+            break;
+        }
+
+        xJob = xTestEDFSharedStackBelow( xJob );
+    }
+
+    if( ( i >= 0 ) || ( xJob != NULL ) )
+    {
+        printf( "tick %lu: the kernel's chain of jobs on the shared stack does not match\n", ( unsigned long ) xNow );
+        iErrors++;
+    }
+
+    return iErrors;
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    TestTask_t * pxRunning;
+    TestTask_t * const pxB = &xTestTasks[ 1 ];
+    TestTask_t * const pxC = &xTestTasks[ 2 ];
+    TickType_t xNow, xWCET;
+    int i, iTick, iDeletedOn = -1, iErrors = 0;
+
+    for( i = 0; i < testTASKS; i++ )
+    {
+        #if ( configEDF_BUDGET_OVERRUN_ACTION == tskEDF_BUDGET_NOTIFY )
+            xWCET = xTestTasks[ i ].xWCET;
+        #else
+            xWCET = 0;
+
+            if( xTaskPeriodicCreateShared( prvJob, xTestTasks[ i ].pcName, NULL, 1, NULL, xTestTasks[ i ].xPeriod,
+                                           xTestTasks[ i ].xRelativeDeadline, xTestTasks[ i ].xWCET, xTestTasks[ i ].xPhase ) != pdFAIL )
+            {
+                printf( "%s was created with a WCET\n", xTestTasks[ i ].pcName );
+                return EXIT_FAILURE;
+            }
+        #endif
+
+        if( xTaskPeriodicCreateShared( prvJob, xTestTasks[ i ].pcName, NULL, 1, &xTestTasks[ i ].xHandle, xTestTasks[ i ].xPeriod,
+                                       xTestTasks[ i ].xRelativeDeadline, xWCET, xTestTasks[ i ].xPhase ) != pdPASS )
+        {
+            printf( "could not create %s\n", xTestTasks[ i ].pcName );
+            return EXIT_FAILURE;
+        }
+
+        xTestTasks[ i ].xWorkLeft = xTestTasks[ i ].xWork;
+    }
+
+    if( xTaskCBSAttach( xTestTasks[ 0 ].xHandle, 2, 10 ) != pdFAIL )
+    {
+        printf( "A was made a server\n" );
+        iErrors++;
+    }
+
+    vHostStartScheduler();
+    iErrors += prvCheckStack( xTaskGetTickCount() );
+
+    for( iTick = 0; iTick < testTICKS; iTick++ )
+    {
+        xNow = xTaskGetTickCount();
+        pxRunning = prvRunning();
+        T1TC += configEDF_BUDGET_COUNTS_PER_TICK;
+
+        if( pxRunning != NULL )
+        {
+            pxRunning->xWorkLeft--;
+
+            if( pxRunning->xWorkLeft == 0 )
+            {
+                /* The job returns at the end of this tick. */
+                pxRunning->xWorkLeft = pxRunning->xWork;
+                prvRemoveStarted( pxRunning );
+                vTestEDFSharedJobCompleted();
+                vTaskSwitchContext();
+
+                /* A task that did not block had its next job released
+                 * already, which starts where this one was. */
+                if( eTaskGetState( pxRunning->xHandle ) != eBlocked )
+                {
+                    pxRunning->xStarted = pdTRUE;
+                    pxRunning->iJobs++;
+                    pxStarted[ iStarted ] = pxRunning;
+                    iStarted++;
+                }
+
+                iErrors += prvCheckStack( xNow );
+            }
+        }
+
+        /* Delete B while C has preempted it. */
+        if( ( iDeletedOn < 0 ) && ( iTick >= testDELETE_AFTER ) && ( pxB->xStarted != pdFALSE ) && ( prvRunning() == pxC ) )
+        {
+            vTaskDelete( pxB->xHandle );
+            prvRemoveStarted( pxB );
+            pxB->xDeleted = pdTRUE;
+            iDeletedOn = ( int ) xNow;
+            iErrors += prvCheckStack( xNow );
+        }
+
+        if( xTaskIncrementTick() != pdFALSE )
+        {
+            vTaskSwitchContext();
+        }
+
+        iErrors += prvCheckStack( xTaskGetTickCount() );
+    }
+
+    if( iDeletedOn < 0 )
+    {
+        printf( "B was never preempted by C after tick %d\n", testDELETE_AFTER );
+        iErrors++;
+    }
+
+    #if ( configEDF_BUDGET_OVERRUN_ACTION == tskEDF_BUDGET_NOTIFY )
+        if( ( uxHostBudgetOverruns != ( UBaseType_t ) pxC->iJobs ) || ( uxTaskGetBudgetOverruns( pxC->xHandle ) != ( UBaseType_t ) pxC->iJobs ) )
+        {
+            printf( "C ran %d jobs, with %lu overruns counted and %lu notified\n", pxC->iJobs,
+                    ( unsigned long ) uxTaskGetBudgetOverruns( pxC->xHandle ), ( unsigned long ) uxHostBudgetOverruns );
+            iErrors++;
+        }
+    #endif
+
+    printf( "shared_stack_test %s: %d ticks, %d, %d and %d jobs, B deleted on tick %d, %lu overruns notified, %lu missed, %d errors\n",
+            testACTION, testTICKS, xTestTasks[ 0 ].iJobs, pxB->iJobs, pxC->iJobs, iDeletedOn,
+            ( unsigned long ) uxHostBudgetOverruns, ( unsigned long ) uxHostDeadlineMisses, iErrors );
+
+    return ( ( uxHostDeadlineMisses == 0 ) && ( iErrors == 0 ) ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,11 @@
+# The shared stack test, with a budget overrun throttled and notified.
+SHARED_STACK_ACTIONS         := throttle notify
+SHARED_STACK_ACTION_throttle := configEDF_BUDGET_OVERRUN_ACTION=tskEDF_BUDGET_THROTTLE
+SHARED_STACK_ACTION_notify   := configEDF_BUDGET_OVERRUN_ACTION=tskEDF_BUDGET_NOTIFY
+$(foreach a,$(SHARED_STACK_ACTIONS),$(eval $(call program,shared_stack_test_$(a),shared_stack_test.c,configUSE_EDF_SHARED_STACK=1 $(SHARED_STACK_ACTION_$(a)))))
+
+.PHONY: check_shared_stack
+check_shared_stack: $(foreach a,$(SHARED_STACK_ACTIONS),$(BUILD)/shared_stack_test_$(a)/shared_stack_test_$(a))
+	@set -e; for a in $(SHARED_STACK_ACTIONS); do $(BUILD)/shared_stack_test_$$a/shared_stack_test_$$a; done
+
+CHECKS += check_shared_stack
@@ -0,0 +1,133 @@
+/*
+ * Runs a job that uses up its budget while it holds SRP resources, with
+ * another user of one of them Ready, under tskEDF_BUDGET_THROTTLE and
+ * tskEDF_BUDGET_DEMOTE.
+ *
+ * L, with a period of 20 ticks, a relative deadline of 12 and a budget of 5
+ * ticks, runs from tick 0.  H, with a period of 20 ticks, a relative deadline
+ * of 10 and a phase of 3, uses resource R1 with L, so R1 has a ceiling of 10.
+ * H is released on tick 3, with a deadline after L's, so is Ready but not
+ * running when L locks R1 and then R2, which only it uses, on tick 4.  L
+ * unlocks R2 on tick 7 and R1 on tick 8.
+ *
+ * L overruns on tick 5, but must keep running, with the deadline of its first
+ * job, until it unlocks R1: a later deadline would let H run and lock R1 too.
+ * Once R1 is unlocked the overrun must be counted and L moved to its release
+ * on tick 20, Blocked under throttling and Ready under demotion, and H must
+ * run.
+ *
+ * Usage: srp_test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "host_port.h"
+
+#define testTICKS    10
+
+#if ( configEDF_BUDGET_OVERRUN_ACTION == tskEDF_BUDGET_THROTTLE )
+    #define testACTION     "throttle"
+    #define testL_STATE    eBlocked
+#else
+    #define testACTION     "demote"
+    #define testL_STATE    eReady
+#endif
+
+static void prvTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    TaskHandle_t xL, xH;
+    SRPResourceHandle_t xR1, xR2;
+    TickType_t xNow;
+    eTaskState eState;
+    BaseType_t xHolding = pdFALSE;
+    int iTick, iErrors = 0;
+
+    if( ( xTaskPeriodicCreateConstrained( prvTask, "L", configMINIMAL_STACK_SIZE, NULL, 1, &xL, 20, 12, 5, 0 ) != pdPASS ) ||
+        ( xTaskPeriodicCreateConstrained( prvTask, "H", configMINIMAL_STACK_SIZE, NULL, 1, &xH, 20, 10, 0, 3 ) != pdPASS ) )
+    {
+        printf( "could not create the tasks\n" );
+        return EXIT_FAILURE;
+    }
+
+    xR1 = xTaskSRPResourceCreate();
+    xR2 = xTaskSRPResourceCreate();
+    vTaskSRPResourceUsedBy( xR1, xL );
+    vTaskSRPResourceUsedBy( xR1, xH );
+    vTaskSRPResourceUsedBy( xR2, xL );
+
+    vHostStartScheduler();
+
+    for( iTick = 0; iTick < testTICKS; iTick++ )
+    {
+        xNow = xTaskGetTickCount();
+
+        if( xNow == 4U )
+        {
+            vTaskSRPLock( xR1 );
+            vTaskSRPLock( xR2 );
+            xHolding = pdTRUE;
+        }
+        else if( xNow == 7U )
+        {
+            vTaskSRPUnlock( xR2 );
+            vTaskSwitchContext();
+        }
+        else if( xNow == 8U )
+        {
+            vTaskSRPUnlock( xR1 );
+            vTaskSwitchContext();
+            xHolding = pdFALSE;
+
+            eState = eTaskGetState( xL );
+
+            if( ( uxTaskGetBudgetOverruns( xL ) != 1U ) || ( xTaskGetReleaseTime( xL ) != 20U ) )
+            {
+                printf( "tick %lu: L has %lu overruns and its release on tick %lu once it unlocked R1\n", ( unsigned long ) xNow,
+                        ( unsigned long ) uxTaskGetBudgetOverruns( xL ), ( unsigned long ) xTaskGetReleaseTime( xL ) );
+                iErrors++;
+            }
+
+            if( eState != testL_STATE )
+            {
+                printf( "tick %lu: L is in state %d once it unlocked R1\n", ( unsigned long ) xNow, ( int ) eState );
+                iErrors++;
+            }
+
+            if( xTaskGetCurrentTaskHandle() != xH )
+            {
+                printf( "tick %lu: H does not run once L unlocked R1\n", ( unsigned long ) xNow );
+                iErrors++;
+            }
+        }
+
+        /* The job of L is not moved while it holds a resource. */
+        if( ( xHolding != pdFALSE ) &&
+            ( ( xTaskGetCurrentTaskHandle() != xL ) || ( xTaskGetReleaseTime( xL ) != 0U ) ) )
+        {
+            printf( "tick %lu: %s runs while L holds R1, with L released on tick %lu\n", ( unsigned long ) xNow,
+                    pcTaskGetName( xTaskGetCurrentTaskHandle() ), ( unsigned long ) xTaskGetReleaseTime( xL ) );
+            iErrors++;
+        }
+
+        T1TC += configEDF_BUDGET_COUNTS_PER_TICK;
+
+        if( xTaskIncrementTick() != pdFALSE )
+        {
+            vTaskSwitchContext();
+        }
+    }
+
+    printf( "srp_test %s: %d ticks, %lu overruns of L, %d errors\n",
+            testACTION, testTICKS, ( unsigned long ) uxTaskGetBudgetOverruns( xL ), iErrors );
+
+    return ( iErrors == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,11 @@
+# The SRP test, with a budget overrun throttled and demoted.
+SRP_ACTIONS         := throttle demote
+SRP_ACTION_throttle := configEDF_BUDGET_OVERRUN_ACTION=tskEDF_BUDGET_THROTTLE
+SRP_ACTION_demote   := configEDF_BUDGET_OVERRUN_ACTION=tskEDF_BUDGET_DEMOTE
+$(foreach a,$(SRP_ACTIONS),$(eval $(call program,srp_test_$(a),srp_test.c,configUSE_EDF_SRP=1 $(SRP_ACTION_$(a)))))
+
+.PHONY: check_srp
+check_srp: $(foreach a,$(SRP_ACTIONS),$(BUILD)/srp_test_$(a)/srp_test_$(a))
+	@set -e; for a in $(SRP_ACTIONS); do $(BUILD)/srp_test_$$a/srp_test_$$a; done
+
+CHECKS += check_srp
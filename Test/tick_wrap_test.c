@@ -0,0 +1,181 @@
+/*
+ * Runs a full task set across the 32-bit tick count wrap.  It is built with
+ * each EDF ready queue, once with configINITIAL_TICK_COUNT at 0 and once at
+ * 0xFFFFFE00, 512 ticks before the wrap.  Each tick the running task does a
+ * tick of work, and calls xTaskDelayUntil() when its job is done, before the
+ * tick is counted.
+ *
+ * After every context switch the running task must have the earliest deadline
+ * of the Ready tasks, comparing deadlines modulo the tick count, and no job may
+ * complete after its deadline.  The program prints a hash of the schedule in
+ * ticks since the start; 'make check' requires it to be the same for both
+ * starting tick counts.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "host_port.h"
+
+#define testTASKS    8
+#define testTICKS    4000
+
+#if ( configUSE_EDF_HEAP_READY_QUEUE == 1 )
+    #define testQUEUE    "heap"
+#elif ( configUSE_EDF_BUCKET_READY_QUEUE == 1 )
+    #define testQUEUE    "bucket"
+#else
+    #define testQUEUE    "list"
+#endif
+
+typedef struct
+{
+    const char * pcName;
+    TickType_t xPeriod;
+    TickType_t xDeadline;
+    TickType_t xWCET;
+    TaskHandle_t xHandle;
+    TickType_t xLastRelease;
+    TickType_t xWorkLeft;
+} TestTask_t;
+
+/* Utilization 0.905, and schedulable with the constrained deadlines. */
+static TestTask_t xTestTasks[ testTASKS ] =
+{
+    { "T5",  5,  5,  1 },
+    { "T8",  8,  6,  1 },
+    { "T10", 10, 10, 1 },
+    { "T16", 16, 12, 2 },
+    { "T20", 20, 20, 2 },
+    { "T25", 25, 25, 2 },
+    { "T40", 40, 30, 3 },
+    { "T50", 50, 50, 5 }
+};
+
+static void prvTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvDeadline( const TestTask_t * pxTask )
+{
+    return xTaskGetReleaseTime( pxTask->xHandle ) + pxTask->xDeadline;
+}
+/*-----------------------------------------------------------*/
+
+static TestTask_t * prvRunning( void )
+{
+    TaskHandle_t xRunning = xTaskGetCurrentTaskHandle();
+    int i;
+
+    for( i = 0; i < testTASKS; i++ )
+    {
+        if( xTestTasks[ i ].xHandle == xRunning )
+        {
+            return &xTestTasks[ i ];
+        }
+    }
+
+    return NULL;
+}
+/*-----------------------------------------------------------*/
+
+/* Count the Ready tasks whose deadline comes before the running task's. */
+static int prvCountOrderingErrors( TickType_t xNow )
+{
+    TestTask_t * pxRunning = prvRunning();
+    int i, iErrors = 0;
+
+    for( i = 0; i < testTASKS; i++ )
+    {
+        if( eTaskGetState( xTestTasks[ i ].xHandle ) != eReady )
+        {
+            continue;
+        }
+
+        if( ( pxRunning == NULL ) ||
+            ( ( int32_t ) ( prvDeadline( &xTestTasks[ i ] ) - prvDeadline( pxRunning ) ) < 0 ) )
+        {
+            printf( "tick %lu: %s runs, but %s is Ready with an earlier deadline\n",
+                    ( unsigned long ) xNow, ( pxRunning != NULL ) ? pxRunning->pcName : "idle", xTestTasks[ i ].pcName );
+            iErrors++;
+        }
+    }
+
+    return iErrors;
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    const TickType_t xStart = ( TickType_t ) configINITIAL_TICK_COUNT;
+    TestTask_t * pxRunning;
+    TickType_t xNow;
+    uint32_t ulHash = 2166136261UL;
+    int i, iTick, iJobs = 0, iLate = 0, iErrors = 0;
+
+    for( i = 0; i < testTASKS; i++ )
+    {
+        if( xTaskPeriodicCreateConstrained( prvTask, xTestTasks[ i ].pcName, configMINIMAL_STACK_SIZE, NULL, 1, &xTestTasks[ i ].xHandle,
+                                            xTestTasks[ i ].xPeriod, xTestTasks[ i ].xDeadline, xTestTasks[ i ].xWCET, 0 ) != pdPASS )
+        {
+            printf( "could not create %s\n", xTestTasks[ i ].pcName );
+            return EXIT_FAILURE;
+        }
+
+        xTestTasks[ i ].xLastRelease = xTaskGetReleaseTime( xTestTasks[ i ].xHandle );
+        xTestTasks[ i ].xWorkLeft = xTestTasks[ i ].xWCET;
+    }
+
+    vHostStartScheduler();
+    iErrors += prvCountOrderingErrors( xTaskGetTickCount() );
+
+    for( iTick = 0; iTick < testTICKS; iTick++ )
+    {
+        xNow = xTaskGetTickCount();
+        pxRunning = prvRunning();
+        ulHash = ( ulHash ^ ( uint32_t ) ( ( xNow - xStart ) * 16U + ( ( pxRunning != NULL ) ? ( uint32_t ) ( pxRunning - xTestTasks ) + 1U : 0U ) ) ) * 16777619UL;
+
+        if( pxRunning != NULL )
+        {
+            pxRunning->xWorkLeft--;
+
+            if( pxRunning->xWorkLeft == 0 )
+            {
+                /* The job finishes at the end of this tick. */
+                if( ( int32_t ) ( ( xNow + 1U ) - prvDeadline( pxRunning ) ) > 0 )
+                {
+                    printf( "tick %lu: %s finished late\n", ( unsigned long ) xNow, pxRunning->pcName );
+                    iLate++;
+                }
+
+                iJobs++;
+                pxRunning->xWorkLeft = pxRunning->xWCET;
+                ( void ) xTaskDelayUntil( &pxRunning->xLastRelease, pxRunning->xPeriod );
+                vTaskSwitchContext();
+                iErrors += prvCountOrderingErrors( xNow );
+            }
+        }
+
+        if( xTaskIncrementTick() != pdFALSE )
+        {
+            vTaskSwitchContext();
+        }
+
+        iErrors += prvCountOrderingErrors( xTaskGetTickCount() );
+    }
+
+    if( ( xStart > xTaskGetTickCount() ) != ( xStart > ( TickType_t ) ( 0U - testTICKS ) ) )
+    {
+        printf( "the tick count did not wrap as expected\n" );
+        iErrors++;
+    }
+
+    printf( "tick_wrap_test %s: %d ticks, %d jobs, %d late, %lu missed, %d ordering errors, schedule %08lx\n",
+            testQUEUE, testTICKS, iJobs, iLate, ( unsigned long ) uxHostDeadlineMisses, iErrors, ( unsigned long ) ulHash );
+
+    return ( ( iLate == 0 ) && ( uxHostDeadlineMisses == 0 ) && ( iErrors == 0 ) ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,19 @@
+# The tick wrap test, with each EDF ready queue, from tick 0 and from 512
+# ticks before the tick count wraps.  The two schedules must be the same.
+TICK_WRAP_QUEUES := list heap bucket
+TICK_WRAP_list   :=
+TICK_WRAP_heap   := configUSE_EDF_HEAP_READY_QUEUE=1 configEDF_MAX_READY_TASKS=16
+TICK_WRAP_bucket := configUSE_EDF_BUCKET_READY_QUEUE=1
+$(foreach q,$(TICK_WRAP_QUEUES),$(eval $(call program,tick_wrap_test_$(q),tick_wrap_test.c,$(TICK_WRAP_$(q)))))
+$(foreach q,$(TICK_WRAP_QUEUES),$(eval $(call program,tick_wrap_test_$(q)_wrap,tick_wrap_test.c,$(TICK_WRAP_$(q)) configINITIAL_TICK_COUNT=0xFFFFFE00UL)))
+
+.PHONY: check_tick_wrap
+check_tick_wrap: $(foreach q,$(TICK_WRAP_QUEUES),$(BUILD)/tick_wrap_test_$(q)/tick_wrap_test_$(q) $(BUILD)/tick_wrap_test_$(q)_wrap/tick_wrap_test_$(q)_wrap)
+	@set -e; for q in $(TICK_WRAP_QUEUES); do \
+	    from0=$$($(BUILD)/tick_wrap_test_$$q/tick_wrap_test_$$q) || { echo "$$from0"; exit 1; }; \
+	    wrap=$$($(BUILD)/tick_wrap_test_$${q}_wrap/tick_wrap_test_$${q}_wrap) || { echo "$$wrap"; exit 1; }; \
+	    echo "$$wrap (across the wrap)"; \
+	    [ "$$from0" = "$$wrap" ] || { echo "the schedule from tick 0 was different: $$from0"; exit 1; }; \
+	done
+
+CHECKS += check_tick_wrap
@@ -0,0 +1,264 @@
+/*
+ * Runs tasks whose jobs often share a deadline under each configEDF_TIE_BREAK
+ * policy.  It is built once for tskEDF_TIE_KEEP_RUNNING, tskEDF_TIE_FIFO and
+ * tskEDF_TIE_ROUND_ROBIN, and each build is run twice.
+ *
+ * Run with no argument, five tasks with periods of 10, 10, 20, 20 and 40 ticks
+ * run for 2000 ticks.  Each tick the running task does a tick of work, and
+ * calls xTaskDelayUntil() when its job is done.  After every context switch no
+ * Ready task may have an earlier deadline than the running one, and no job may
+ * complete after its deadline.  vTaskGetTieBreakStats() must show no switches
+ * between equal deadlines made by the policy when it keeps the running task,
+ * and some when it is round robin.
+ *
+ * Run with 'resume', B, with a period of 30 ticks, is suspended at tick 0 and
+ * A, with a period of 20 ticks and a phase of 10, runs from tick 10.  Both jobs
+ * are due on tick 30.  B is resumed on tick 11: it must take the processor at
+ * once under FIFO, as its job was released first, on the next tick under round
+ * robin, and not at all when the policy keeps the running task.
+ *
+ * Usage: tie_break_test [resume]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "host_port.h"
+
+#define testTASKS    5
+#define testTICKS    2000
+
+#if ( configEDF_TIE_BREAK == tskEDF_TIE_FIFO )
+    #define testPOLICY    "fifo"
+#elif ( configEDF_TIE_BREAK == tskEDF_TIE_ROUND_ROBIN )
+    #define testPOLICY    "round robin"
+#else
+    #define testPOLICY    "keep running"
+#endif
+
+typedef struct
+{
+    const char * pcName;
+    TickType_t xPeriod;
+    TickType_t xWCET;
+    TaskHandle_t xHandle;
+    TickType_t xLastRelease;
+    TickType_t xWorkLeft;
+} TestTask_t;
+
+/* Utilization 0.8, with the jobs of the pairs of tasks released together and
+ * due together. */
+static TestTask_t xTestTasks[ testTASKS ] =
+{
+    { "A10", 10, 2 },
+    { "B10", 10, 2 },
+    { "C20", 20, 3 },
+    { "D20", 20, 3 },
+    { "E40", 40, 4 }
+};
+
+static void prvTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvDeadline( const TestTask_t * pxTask )
+{
+    return xTaskGetReleaseTime( pxTask->xHandle ) + pxTask->xPeriod;
+}
+/*-----------------------------------------------------------*/
+
+static TestTask_t * prvRunning( void )
+{
+    TaskHandle_t xRunning = xTaskGetCurrentTaskHandle();
+    int i;
+
+    for( i = 0; i < testTASKS; i++ )
+    {
+        if( xTestTasks[ i ].xHandle == xRunning )
+        {
+            return &xTestTasks[ i ];
+        }
+    }
+
+    return NULL;
+}
+/*-----------------------------------------------------------*/
+
+/* Count the Ready tasks whose deadline comes before the running task's. */
+static int prvCountOrderingErrors( TickType_t xNow )
+{
+    TestTask_t * pxRunning = prvRunning();
+    int i, iErrors = 0;
+
+    for( i = 0; i < testTASKS; i++ )
+    {
+        if( eTaskGetState( xTestTasks[ i ].xHandle ) != eReady )
+        {
+            continue;
+        }
+
+        if( ( pxRunning == NULL ) ||
+            ( ( int32_t ) ( prvDeadline( &xTestTasks[ i ] ) - prvDeadline( pxRunning ) ) < 0 ) )
+        {
+            printf( "tick %lu: %s runs, but %s is Ready with an earlier deadline\n",
+                    ( unsigned long ) xNow, ( pxRunning != NULL ) ? pxRunning->pcName : "idle", xTestTasks[ i ].pcName );
+            iErrors++;
+        }
+    }
+
+    return iErrors;
+}
+/*-----------------------------------------------------------*/
+
+static int prvRunTaskSet( void )
+{
+    TestTask_t * pxRunning;
+    TickType_t xNow;
+    UBaseType_t uxSwitches, uxTiesKept, uxTieSwitches;
+    int i, iTick, iJobs = 0, iLate = 0, iErrors = 0;
+
+    for( i = 0; i < testTASKS; i++ )
+    {
+        if( xTaskPeriodicCreateConstrained( prvTask, xTestTasks[ i ].pcName, configMINIMAL_STACK_SIZE, NULL, 1, &xTestTasks[ i ].xHandle,
+                                            xTestTasks[ i ].xPeriod, xTestTasks[ i ].xPeriod, xTestTasks[ i ].xWCET, 0 ) != pdPASS )
+        {
+            printf( "could not create %s\n", xTestTasks[ i ].pcName );
+            return EXIT_FAILURE;
+        }
+
+        xTestTasks[ i ].xLastRelease = xTaskGetReleaseTime( xTestTasks[ i ].xHandle );
+        xTestTasks[ i ].xWorkLeft = xTestTasks[ i ].xWCET;
+    }
+
+    vHostStartScheduler();
+    iErrors += prvCountOrderingErrors( xTaskGetTickCount() );
+
+    for( iTick = 0; iTick < testTICKS; iTick++ )
+    {
+        xNow = xTaskGetTickCount();
+        pxRunning = prvRunning();
+
+        if( pxRunning != NULL )
+        {
+            pxRunning->xWorkLeft--;
+
+            if( pxRunning->xWorkLeft == 0 )
+            {
+                /* The job finishes at the end of this tick. */
+                if( ( int32_t ) ( ( xNow + 1U ) - prvDeadline( pxRunning ) ) > 0 )
+                {
+                    printf( "tick %lu: %s finished late\n", ( unsigned long ) xNow, pxRunning->pcName );
+                    iLate++;
+                }
+
+                iJobs++;
+                pxRunning->xWorkLeft = pxRunning->xWCET;
+                ( void ) xTaskDelayUntil( &pxRunning->xLastRelease, pxRunning->xPeriod );
+                vTaskSwitchContext();
+                iErrors += prvCountOrderingErrors( xNow );
+            }
+        }
+
+        if( xTaskIncrementTick() != pdFALSE )
+        {
+            vTaskSwitchContext();
+        }
+
+        iErrors += prvCountOrderingErrors( xTaskGetTickCount() );
+    }
+
+    vTaskGetTieBreakStats( &uxSwitches, &uxTiesKept, &uxTieSwitches );
+
+    #if ( configEDF_TIE_BREAK == tskEDF_TIE_ROUND_ROBIN )
+        if( uxTieSwitches == 0U )
+        {
+            printf( "round robin made no switches between equal deadlines\n" );
+            iErrors++;
+        }
+    #elif ( configEDF_TIE_BREAK == tskEDF_TIE_KEEP_RUNNING )
+        if( uxTieSwitches != 0U )
+        {
+            printf( "the running task was switched out for an equal deadline\n" );
+            iErrors++;
+        }
+    #endif
+
+    printf( "tie_break_test %s: %d ticks, %d jobs, %d late, %lu missed, %lu switches, %lu ties kept, %lu tie switches, %d errors\n",
+            testPOLICY, testTICKS, iJobs, iLate, ( unsigned long ) uxHostDeadlineMisses,
+            ( unsigned long ) uxSwitches, ( unsigned long ) uxTiesKept, ( unsigned long ) uxTieSwitches, iErrors );
+
+    return ( ( iLate == 0 ) && ( uxHostDeadlineMisses == 0 ) && ( iErrors == 0 ) ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+/*-----------------------------------------------------------*/
+
+static int prvRunResume( void )
+{
+    TaskHandle_t xA, xB, xOnResume, xNextTick;
+    int iTick, iErrors = 0;
+
+    if( ( xTaskPeriodicCreate( prvTask, "B", configMINIMAL_STACK_SIZE, NULL, 1, &xB, 30 ) != pdPASS ) ||
+        ( xTaskPeriodicCreateConstrained( prvTask, "A", configMINIMAL_STACK_SIZE, NULL, 1, &xA, 20, 20, 0, 10 ) != pdPASS ) )
+    {
+        printf( "could not create the tasks\n" );
+        return EXIT_FAILURE;
+    }
+
+    vHostStartScheduler();
+    vTaskSuspend( xB );
+    vTaskSwitchContext();
+
+    for( iTick = 0; iTick < 11; iTick++ )
+    {
+        if( xTaskIncrementTick() != pdFALSE )
+        {
+            vTaskSwitchContext();
+        }
+    }
+
+    if( xTaskGetCurrentTaskHandle() != xA )
+    {
+        printf( "A is not running on tick %lu\n", ( unsigned long ) xTaskGetTickCount() );
+        iErrors++;
+    }
+
+    vTaskResume( xB );
+    vTaskSwitchContext();
+    xOnResume = xTaskGetCurrentTaskHandle();
+
+    if( xTaskIncrementTick() != pdFALSE )
+    {
+        vTaskSwitchContext();
+    }
+
+    xNextTick = xTaskGetCurrentTaskHandle();
+
+    #if ( configEDF_TIE_BREAK == tskEDF_TIE_FIFO )
+        iErrors += ( ( xOnResume == xB ) && ( xNextTick == xB ) ) ? 0 : 1;
+    #elif ( configEDF_TIE_BREAK == tskEDF_TIE_ROUND_ROBIN )
+        iErrors += ( ( xOnResume == xA ) && ( xNextTick == xB ) ) ? 0 : 1;
+    #else
+        iErrors += ( ( xOnResume == xA ) && ( xNextTick == xA ) ) ? 0 : 1;
+    #endif
+
+    printf( "tie_break_test %s resume: %s runs when B is resumed and %s on the next tick, %d errors\n",
+            testPOLICY, pcTaskGetName( xOnResume ), pcTaskGetName( xNextTick ), iErrors );
+
+    return ( iErrors == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char ** argv )
+{
+    if( ( argc > 1 ) && ( strcmp( argv[ 1 ], "resume" ) == 0 ) )
+    {
+        return prvRunResume();
+    }
+
+    return prvRunTaskSet();
+}
@@ -0,0 +1,16 @@
+# The tie break test, with each configEDF_TIE_BREAK policy, running the task
+# set and then the resume of a job released before the running one.
+TIE_BREAK_POLICIES := keep fifo round_robin
+TIE_BREAK_keep        := configEDF_TIE_BREAK=tskEDF_TIE_KEEP_RUNNING
+TIE_BREAK_fifo        := configEDF_TIE_BREAK=tskEDF_TIE_FIFO
+TIE_BREAK_round_robin := configEDF_TIE_BREAK=tskEDF_TIE_ROUND_ROBIN
+$(foreach p,$(TIE_BREAK_POLICIES),$(eval $(call program,tie_break_test_$(p),tie_break_test.c,$(TIE_BREAK_$(p)))))
+
+.PHONY: check_tie_break
+check_tie_break: $(foreach p,$(TIE_BREAK_POLICIES),$(BUILD)/tie_break_test_$(p)/tie_break_test_$(p))
+	@set -e; for p in $(TIE_BREAK_POLICIES); do \
+	    $(BUILD)/tie_break_test_$$p/tie_break_test_$$p; \
+	    $(BUILD)/tie_break_test_$$p/tie_break_test_$$p resume; \
+	done
+
+CHECKS += check_tie_break
@@ -0,0 +1,203 @@
+/*
+ * Delays tasks for random times of up to 3000 ticks, some of them shorter than
+ * a first-level slot run, some held by the second level and some too long for
+ * the wheel, and checks that each wakes on the tick it asked for.  It is built
+ * with configUSE_TIMING_WHEEL set to 1 and to 0, each with
+ * configINITIAL_TICK_COUNT at 0 and at 0xFFFFFE00, 512 ticks before the tick
+ * count wraps.
+ *
+ * Each tick, every task that gets to run calls vTaskDelay() at once, and now
+ * and then a Blocked task is woken early with xTaskAbortDelay().  The first
+ * delays end on the ticks around the wrap in the builds that cross it.  After
+ * every tick a task must be Blocked until its wake time and Ready from then on.
+ * The program prints a hash of the delays and wakes in ticks since the start;
+ * 'make check' requires it to be the same for all four builds.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "host_port.h"
+
+#define testTASKS         8
+#define testTICKS         100000
+#define testABORT_EVERY   500
+
+#if ( configUSE_TIMING_WHEEL == 1 )
+    #define testDELAYS    "timing wheel"
+#else
+    #define testDELAYS    "delayed lists"
+#endif
+
+typedef struct
+{
+    TaskHandle_t xHandle;
+    TickType_t xWakeTime;
+    BaseType_t xDelayed;
+} TestTask_t;
+
+/* A delay is as likely to be within a first-level slot run as within the
+ * wheel and longer than it. */
+static const unsigned long ulDelayRanges[ 3 ] = { 32UL, 1024UL, 3000UL };
+
+/* The first delays end on either side of the wrap, and on the tick it wraps
+ * to 0, when the test starts 512 ticks before it. */
+static const TickType_t xFirstDelays[ 3 ] = { 511, 512, 513 };
+
+static TestTask_t xTestTasks[ testTASKS ];
+static unsigned long ulRandom = 1UL;
+static uint32_t ulHash = 2166136261UL;
+
+static void prvTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+}
+/*-----------------------------------------------------------*/
+
+static unsigned long prvRandom( unsigned long ulRange )
+{
+    ulRandom = ulRandom * 1103515245UL + 12345UL;
+
+    return ( ( ulRandom >> 8 ) & 0xFFFFFFUL ) % ulRange;
+}
+/*-----------------------------------------------------------*/
+
+static void prvHash( uint32_t ulValue )
+{
+    ulHash = ( ulHash ^ ulValue ) * 16777619UL;
+}
+/*-----------------------------------------------------------*/
+
+static TestTask_t * prvRunning( void )
+{
+    TaskHandle_t xRunning = xTaskGetCurrentTaskHandle();
+    int i;
+
+    for( i = 0; i < testTASKS; i++ )
+    {
+        if( xTestTasks[ i ].xHandle == xRunning )
+        {
+            return &xTestTasks[ i ];
+        }
+    }
+
+    return NULL;
+}
+/*-----------------------------------------------------------*/
+
+/* Check each task's state against its wake time, and note the tasks that
+ * have woken. */
+static int prvCheckStates( TickType_t xNow,
+                           TickType_t xStart )
+{
+    eTaskState eState;
+    int i, iErrors = 0;
+
+    for( i = 0; i < testTASKS; i++ )
+    {
+        eState = eTaskGetState( xTestTasks[ i ].xHandle );
+
+        if( ( xTestTasks[ i ].xDelayed != pdFALSE ) && ( xTestTasks[ i ].xWakeTime == xNow ) )
+        {
+            xTestTasks[ i ].xDelayed = pdFALSE;
+            prvHash( ( uint32_t ) ( xNow - xStart ) * 16U + ( uint32_t ) i );
+        }
+
+        if( ( xTestTasks[ i ].xDelayed != pdFALSE ) ? ( eState != eBlocked ) : ( ( eState != eReady ) && ( eState != eRunning ) ) )
+        {
+            printf( "tick %lu: task %d is in state %d, with its wake time at tick %lu\n",
+                    ( unsigned long ) xNow, i, ( int ) eState, ( unsigned long ) xTestTasks[ i ].xWakeTime );
+            iErrors++;
+        }
+    }
+
+    return iErrors;
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    const TickType_t xStart = ( TickType_t ) configINITIAL_TICK_COUNT;
+    TestTask_t * pxRunning;
+    TickType_t xNow, xDelay;
+    int i, iTick, iDelays = 0, iAborts = 0, iErrors = 0;
+
+    /* Different periods give the tasks woken on the same tick different
+     * deadlines, so the order they run in does not depend on the order they
+     * were woken in. */
+    for( i = 0; i < testTASKS; i++ )
+    {
+        if( xTaskPeriodicCreate( prvTask, "T", configMINIMAL_STACK_SIZE, NULL, 1, &xTestTasks[ i ].xHandle, ( TickType_t ) ( 100 + i ) ) != pdPASS )
+        {
+            printf( "could not create task %d\n", i );
+            return EXIT_FAILURE;
+        }
+    }
+
+    vHostStartScheduler();
+
+    for( iTick = 0; iTick < testTICKS; iTick++ )
+    {
+        xNow = xTaskGetTickCount();
+
+        while( ( pxRunning = prvRunning() ) != NULL )
+        {
+            if( iDelays < ( int ) ( sizeof( xFirstDelays ) / sizeof( xFirstDelays[ 0 ] ) ) )
+            {
+                xDelay = xFirstDelays[ iDelays ];
+            }
+            else
+            {
+                xDelay = ( TickType_t ) ( prvRandom( ulDelayRanges[ prvRandom( 3UL ) ] ) + 1UL );
+            }
+
+            pxRunning->xWakeTime = xNow + xDelay;
+            pxRunning->xDelayed = pdTRUE;
+            prvHash( ( uint32_t ) ( pxRunning - xTestTasks ) * 4096U + ( uint32_t ) xDelay );
+            iDelays++;
+
+            vTaskDelay( xDelay );
+            vTaskSwitchContext();
+        }
+
+        if( ( iTick % testABORT_EVERY ) == ( testABORT_EVERY - 1 ) )
+        {
+            i = ( int ) prvRandom( testTASKS );
+
+            if( xTestTasks[ i ].xDelayed != pdFALSE )
+            {
+                if( xTaskAbortDelay( xTestTasks[ i ].xHandle ) != pdPASS )
+                {
+                    printf( "tick %lu: could not abort the delay of task %d\n", ( unsigned long ) xNow, i );
+                    iErrors++;
+                }
+
+                xTestTasks[ i ].xWakeTime = xNow;
+                iAborts++;
+                vTaskSwitchContext();
+            }
+        }
+
+        iErrors += prvCheckStates( xNow, xStart );
+
+        if( xTaskIncrementTick() != pdFALSE )
+        {
+            vTaskSwitchContext();
+        }
+
+        iErrors += prvCheckStates( xTaskGetTickCount(), xStart );
+    }
+
+    if( ( xStart > xTaskGetTickCount() ) != ( xStart > ( TickType_t ) ( 0U - testTICKS ) ) )
+    {
+        printf( "the tick count did not wrap as expected\n" );
+        iErrors++;
+    }
+
+    printf( "timing_wheel_test %s: %d ticks, %d delays, %d aborted, %d errors, schedule %08lx\n",
+            testDELAYS, testTICKS, iDelays, iAborts, iErrors, ( unsigned long ) ulHash );
+
+    return ( iErrors == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,21 @@
+# The timing wheel test, with the timing wheel and with the delayed lists
+# alone, from tick 0 and from 512 ticks before the tick count wraps.  All four
+# must wake the tasks on the same ticks.
+TIMING_WHEEL_BUILDS := wheel wheel_wrap lists lists_wrap
+TIMING_WHEEL_CONFIG := INCLUDE_xTaskAbortDelay=1
+TIMING_WHEEL_wheel      := configUSE_TIMING_WHEEL=1
+TIMING_WHEEL_wheel_wrap := configUSE_TIMING_WHEEL=1 configINITIAL_TICK_COUNT=0xFFFFFE00UL
+TIMING_WHEEL_lists      := configUSE_TIMING_WHEEL=0
+TIMING_WHEEL_lists_wrap := configUSE_TIMING_WHEEL=0 configINITIAL_TICK_COUNT=0xFFFFFE00UL
+$(foreach b,$(TIMING_WHEEL_BUILDS),$(eval $(call program,timing_wheel_test_$(b),timing_wheel_test.c,$(TIMING_WHEEL_CONFIG) $(TIMING_WHEEL_$(b)))))
+
+.PHONY: check_timing_wheel
+check_timing_wheel: $(foreach b,$(TIMING_WHEEL_BUILDS),$(BUILD)/timing_wheel_test_$(b)/timing_wheel_test_$(b))
+	@set -e; first=; for b in $(TIMING_WHEEL_BUILDS); do \
+	    out=$$($(BUILD)/timing_wheel_test_$$b/timing_wheel_test_$$b) || { echo "$$out"; exit 1; }; \
+	    echo "$$out"; \
+	    [ -z "$$first" ] || [ "$${out#*: }" = "$$first" ] || { echo "the $$b build woke the tasks differently"; exit 1; }; \
+	    first=$${out#*: }; \
+	done
+
+CHECKS += check_timing_wheel